@@ -0,0 +1,158 @@
+# Path conversion shared by the ld, lipo and strip wrappers.
+#
+# The extern/ tools are native Windows programs, so every path on their
+# command line must be turned into an absolute Windows path. This is done in
+# this process through cygwin_conv_path; if cygwin1.dll cannot be loaded, one
+# cygpath process converts the whole batch. Under a native Windows python the
+# paths already are Windows paths and only need to be made absolute, so the
+# wrappers run without Cygwin at all.
+import os, sys, shlex, subprocess, tempfile
+
+CCP_POSIX_TO_WIN_A = 0
+FS_ENCODING = sys.getfilesystemencoding() or "utf-8"
+
+def _load_conv_path():
+	try:
+		import ctypes
+		conv = ctypes.CDLL("cygwin1.dll").cygwin_conv_path
+	except (ImportError, OSError, AttributeError):
+		return None
+	conv.argtypes = [ctypes.c_uint, ctypes.c_char_p, ctypes.c_char_p, ctypes.c_size_t]
+	conv.restype = ctypes.c_ssize_t
+	return conv
+
+_conv_path = _load_conv_path()
+
+def _to_bytes(s):
+	if isinstance(s, bytes):
+		return s
+	return s.encode(FS_ENCODING)
+
+def _to_str(b):
+	if isinstance(b, str):
+		return b
+	return b.decode(FS_ENCODING)
+
+def to_windows(paths):
+	"""Convert a list of Cygwin paths, or native paths when not running
+	under Cygwin, to absolute Windows paths."""
+	if not paths:
+		return []
+	if os.name == "nt":
+		return [os.path.abspath(path) for path in paths]
+	if _conv_path:
+		import ctypes
+		result = []
+		for path in paths:
+			src = _to_bytes(path)
+			size = _conv_path(CCP_POSIX_TO_WIN_A, src, None, 0)
+			if size < 0:
+				raise OSError("cannot convert path '" + path + "'")
+			buf = ctypes.create_string_buffer(size)
+			_conv_path(CCP_POSIX_TO_WIN_A, src, buf, size)
+			result.append(_to_str(buf.value))
+		return result
+	proc = subprocess.Popen(["cygpath", "-wa", "-f", "-"],
+	                        stdin=subprocess.PIPE, stdout=subprocess.PIPE)
+	out = proc.communicate(_to_bytes("\n".join(paths) + "\n"))[0]
+	return _to_str(out).splitlines()
+
+# Entries of a -filelist are converted and written this many at a time, so
+# the memory used does not grow with the size of the list.
+BATCH_SIZE = 4096
+
+def _expand_filelist(arg, verbose):
+	"""Rewrite an ld -filelist argument, 'file[,dirname]', as a temporary
+	file of Windows paths. Returns the new argument and the temporary file."""
+	listfile, sep, dirname = arg.partition(",")
+	fd, tmp = tempfile.mkstemp(suffix=".filelist")
+	out = os.fdopen(fd, "w")
+	count = 0
+	batch = []
+	f = open(listfile)
+	try:
+		for line in f:
+			entry = line.rstrip("\r\n")
+			if not entry.strip():
+				continue
+			if sep:
+				entry = os.path.join(dirname, entry)
+			batch.append(entry)
+			if len(batch) == BATCH_SIZE:
+				out.write("\n".join(to_windows(batch)) + "\n")
+				count += len(batch)
+				batch = []
+		if batch:
+			out.write("\n".join(to_windows(batch)) + "\n")
+			count += len(batch)
+	finally:
+		f.close()
+		out.close()
+	if verbose:
+		print("Converted " + str(count) + " paths in filelist '" + listfile + "'")
+	return to_windows([tmp])[0], tmp
+
+def _quote(arg):
+	return '"' + arg.replace("\\", "\\\\").replace('"', '\\"') + '"'
+
+def _expand_response_file(rspfile, prefixes, verbose, temps):
+	"""Rewrite the arguments of an @rspfile, converting them like those on
+	the command line, into a temporary response file. Returns its path."""
+	f = open(rspfile)
+	try:
+		args = shlex.split(f.read())
+	finally:
+		f.close()
+	_convert(args, prefixes, True, verbose, temps)
+	fd, tmp = tempfile.mkstemp(suffix=".rsp")
+	temps.append(tmp)
+	out = os.fdopen(fd, "w")
+	try:
+		for arg in args:
+			out.write(_quote(arg) + "\n")
+	finally:
+		out.close()
+	if verbose:
+		print("Converted response file '" + rspfile + "'")
+	return to_windows([tmp])[0]
+
+def _convert(argv, prefixes, expand, verbose, temps):
+	indices = []
+	paths = []
+	x = 0
+	while x < len(argv):
+		arg = argv[x]
+		if expand and arg == "-filelist" and x + 1 < len(argv):
+			argv[x + 1], tmp = _expand_filelist(argv[x + 1], verbose)
+			temps.append(tmp)
+			x += 2
+			continue
+		if expand and arg.startswith("@") and os.path.isfile(arg[1:]):
+			argv[x] = "@" + _expand_response_file(arg[1:], prefixes, verbose,
+			                                      temps)
+			x += 1
+			continue
+		if os.path.exists(arg):
+			indices.append((x, ""))
+			paths.append(arg)
+		else:
+			for prefix in prefixes:
+				if arg.startswith(prefix):
+					indices.append((x, prefix))
+					paths.append(arg[len(prefix):])
+					break
+		x += 1
+	for (x, prefix), path, winpath in zip(indices, paths, to_windows(paths)):
+		if verbose:
+			print("Converting '" + path + "' to " + winpath)
+		argv[x] = prefix + winpath
+
+def convert_argv(argv, prefixes=(), expand=False):
+	"""Convert, in place, every argument of argv that names an existing file
+	and the path part of every argument starting with one of prefixes. With
+	expand, the files named by -filelist and @response file arguments are
+	rewritten with converted paths too. Returns the temporary files created,
+	which the caller must remove once the tool has run."""
+	temps = []
+	_convert(argv, prefixes, expand, "-v" in argv, temps)
+	return temps
@@ -0,0 +1,102 @@
+# Relink avoidance for the ld wrapper.
+#
+# ld64 127.2 has no incremental mode, so a debug relink always starts from
+# scratch. What can be done from outside is to notice that nothing changed:
+# the command line and the size and modification time of every input are
+# saved next to the output, and a link whose saved state still matches is
+# skipped.
+import os, hashlib
+
+STATE_SUFFIX = ".ldstate"
+
+def _filelist_entries(arg):
+	listfile, sep, dirname = arg.partition(",")
+	entries = [listfile]
+	f = open(listfile)
+	try:
+		for line in f:
+			entry = line.rstrip("\r\n")
+			if entry.strip():
+				entries.append(os.path.join(dirname, entry) if sep else entry)
+	finally:
+		f.close()
+	return entries
+
+def _find_in(dirs, names):
+	for d in dirs:
+		for name in names:
+			path = os.path.join(d, name)
+			if os.path.isfile(path):
+				return path
+	return None
+
+def _inputs(argv):
+	"""The files the link reads: the arguments that name files, the entries
+	of -filelist, and the -l and -framework inputs found on the -L and -F
+	paths. Inputs found only in the SDK are not tracked."""
+	libdirs = [a[2:] for a in argv if a.startswith("-L") and len(a) > 2]
+	fwdirs = [a[2:] for a in argv if a.startswith("-F") and len(a) > 2]
+	files = []
+	x = 1
+	while x < len(argv):
+		arg = argv[x]
+		if arg == "-filelist" and x + 1 < len(argv):
+			files.extend(_filelist_entries(argv[x + 1]))
+			x += 2
+			continue
+		if arg == "-framework" and x + 1 < len(argv):
+			name = argv[x + 1]
+			path = _find_in(fwdirs, [name + ".framework/" + name])
+			if path:
+				files.append(path)
+			x += 2
+			continue
+		if arg == "-o":
+			x += 2
+			continue
+		if arg.startswith("-l") and len(arg) > 2:
+			path = _find_in(libdirs, ["lib" + arg[2:] + ".dylib",
+			                          "lib" + arg[2:] + ".a"])
+			if path:
+				files.append(path)
+		elif arg.startswith("@") and os.path.isfile(arg[1:]):
+			files.append(arg[1:])
+		elif os.path.isfile(arg):
+			files.append(arg)
+		x += 1
+	return files
+
+def compute_state(argv):
+	"""A digest of the command line and of the size and modification time of
+	every input of the link."""
+	h = hashlib.sha1()
+	for arg in argv[1:]:
+		h.update(arg.encode("utf-8", "replace") + b"\0")
+	for path in _inputs(argv):
+		st = os.stat(path)
+		h.update((path + "\0" + str(st.st_size) + "\0" +
+		          repr(st.st_mtime) + "\0").encode("utf-8", "replace"))
+	return h.hexdigest()
+
+def is_up_to_date(output, state):
+	if not os.path.isfile(output):
+		return False
+	try:
+		f = open(output + STATE_SUFFIX)
+	except IOError:
+		return False
+	try:
+		return f.read().strip() == state
+	finally:
+		f.close()
+
+def save_state(output, state):
+	f = open(output + STATE_SUFFIX, "w")
+	try:
+		f.write(state + "\n")
+	finally:
+		f.close()
+
+def forget_state(output):
+	if os.path.exists(output + STATE_SUFFIX):
+		os.remove(output + STATE_SUFFIX)
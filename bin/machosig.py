@@ -0,0 +1,104 @@
+# Reserve code signature space in a freshly linked Mach-O image in place.
+#
+# codesign_allocate makes room for LC_CODE_SIGNATURE by writing a new copy of
+# the whole binary. When __LINKEDIT is the last thing in the file and the
+# header padding left by ld has room for one more load command, the same
+# result is obtained by appending the command to the header, growing
+# __LINKEDIT and extending the file, touching only a few bytes.
+import os, struct
+
+MH_MAGIC = 0xfeedface
+MH_MAGIC_64 = 0xfeedfacf
+LC_SEGMENT = 0x1
+LC_SEGMENT_64 = 0x19
+LC_CODE_SIGNATURE = 0x1d
+CPU_TYPE_ARM64 = 0x0100000c
+
+def _align(value, alignment):
+	return (value + alignment - 1) & ~(alignment - 1)
+
+def reserve_code_signature(path, size):
+	"""Add an LC_CODE_SIGNATURE of size bytes at the end of the thin Mach-O
+	file at path. Returns False, without changing the file, if that cannot
+	be done in place."""
+	f = open(path, "r+b")
+	try:
+		head = f.read(32)
+		if len(head) < 28:
+			return False
+		magic, cputype = struct.unpack("<II", head[:8])
+		if magic == MH_MAGIC:
+			is64 = False
+			headersize = 28
+		elif magic == MH_MAGIC_64:
+			is64 = True
+			headersize = 32
+		else:
+			return False
+		ncmds, sizeofcmds = struct.unpack("<II", head[16:24])
+		f.seek(headersize)
+		cmds = f.read(sizeofcmds)
+		if len(cmds) != sizeofcmds:
+			return False
+		f.seek(0, os.SEEK_END)
+		filesize = f.tell()
+
+		linkedit = None
+		firstsection = filesize
+		offset = 0
+		for i in range(ncmds):
+			cmd, cmdsize = struct.unpack("<II", cmds[offset:offset+8])
+			if cmd == LC_CODE_SIGNATURE:
+				return False
+			if cmd in (LC_SEGMENT, LC_SEGMENT_64):
+				name = cmds[offset+8:offset+24].rstrip(b"\0")
+				if is64:
+					vmaddr, vmsize, fileoff, segsize = struct.unpack("<QQQQ", cmds[offset+24:offset+56])
+					nsects = struct.unpack("<I", cmds[offset+64:offset+68])[0]
+					sect, sectsize, offfield = offset + 72, 80, 48
+				else:
+					vmaddr, vmsize, fileoff, segsize = struct.unpack("<IIII", cmds[offset+24:offset+40])
+					nsects = struct.unpack("<I", cmds[offset+48:offset+52])[0]
+					sect, sectsize, offfield = offset + 56, 68, 40
+				for s in range(nsects):
+					start = sect + s * sectsize + offfield
+					secoff = struct.unpack("<I", cmds[start:start+4])[0]
+					if secoff:
+						firstsection = min(firstsection, secoff)
+				if name == b"__LINKEDIT":
+					linkedit = (offset, fileoff, segsize)
+			offset += cmdsize
+
+		if linkedit is None:
+			return False
+		lcoff, fileoff, segsize = linkedit
+		if fileoff + segsize != filesize:
+			return False
+		if headersize + sizeofcmds + 16 > firstsection:
+			return False
+
+		pagesize = 0x4000 if cputype == CPU_TYPE_ARM64 else 0x1000
+		dataoff = _align(filesize, 16)
+		newsize = dataoff + size
+		segsize = newsize - fileoff
+		vmsize = _align(segsize, pagesize)
+
+		# The new command goes into the header padding.
+		f.seek(headersize + sizeofcmds)
+		f.write(struct.pack("<IIII", LC_CODE_SIGNATURE, 16, dataoff, size))
+		f.seek(16)
+		f.write(struct.pack("<II", ncmds + 1, sizeofcmds + 16))
+		if is64:
+			f.seek(headersize + lcoff + 32)
+			f.write(struct.pack("<Q", vmsize))
+			f.seek(headersize + lcoff + 48)
+			f.write(struct.pack("<Q", segsize))
+		else:
+			f.seek(headersize + lcoff + 28)
+			f.write(struct.pack("<I", vmsize))
+			f.seek(headersize + lcoff + 36)
+			f.write(struct.pack("<I", segsize))
+		f.truncate(newsize)
+		return True
+	finally:
+		f.close()
@@ -390,6 +390,32 @@ private:
   /// AST objects will be released when the ASTContext itself is destroyed.
   mutable llvm::BumpPtrAllocator BumpAlloc;
 
+public:
+  /// \brief Allocation totals for one class of AST node, collected for
+  /// -print-ast-memory-stats.
+  struct NodeAllocationStats {
+    unsigned Count;
+    uint64_t Bytes;
+    NodeAllocationStats() : Count(0), Bytes(0) {}
+  };
+
+private:
+  /// \brief Whether Decl, Stmt and Type allocations are being counted.
+  bool CollectAllocationStats;
+
+  /// \brief Allocation totals indexed by Decl::Kind, Stmt::StmtClass and
+  /// Type::TypeClass respectively.
+  mutable std::vector<NodeAllocationStats> DeclAllocations, StmtAllocations,
+      TypeAllocations;
+
+  static void noteAllocation(std::vector<NodeAllocationStats> &Stats,
+                             unsigned Kind, size_t Size) {
+    if (Kind >= Stats.size())
+      Stats.resize(Kind + 1);
+    ++Stats[Kind].Count;
+    Stats[Kind].Bytes += Size;
+  }
+
   /// \brief Allocator for partial diagnostics.
   PartialDiagnostic::StorageAllocator DiagAllocator;
 
@@ -484,6 +510,37 @@ public:
   }
   /// Return the total memory used for various side tables.
   size_t getSideTableAllocatedMemory() const;
+
+  /// \brief Scale the slabs of the AST allocator by 2^\p Shift, so that very
+  /// large translation units make fewer, larger allocations. Must be called
+  /// before any AST node is created.
+  void setAllocatorSlabSizeShift(unsigned Shift) {
+    BumpAlloc.setSlabSizeShift(Shift);
+  }
+
+  /// \brief Start counting the objects and bytes allocated for each class
+  /// of Decl, Stmt and Type.
+  void setCollectAllocationStats(bool Collect) {
+    CollectAllocationStats = Collect;
+  }
+  bool isCollectingAllocationStats() const { return CollectAllocationStats; }
+
+  /// \brief Called by the Decl, Stmt and Type allocation paths when
+  /// allocation statistics are being collected.
+  /// @{
+  void noteDeclAllocation(unsigned Kind, size_t Size) const {
+    if (CollectAllocationStats)
+      noteAllocation(DeclAllocations, Kind, Size);
+  }
+  void noteStmtAllocation(unsigned Class, size_t Size) const {
+    if (CollectAllocationStats)
+      noteAllocation(StmtAllocations, Class, Size);
+  }
+  void noteTypeAllocation(unsigned Class, size_t Size) const {
+    if (CollectAllocationStats)
+      noteAllocation(TypeAllocations, Class, Size);
+  }
+  /// @}
   
   PartialDiagnostic::StorageAllocator &getDiagAllocator() {
     return DiagAllocator;
@@ -834,6 +891,12 @@ public:
   ASTMutationListener *getASTMutationListener() const { return Listener; }
 
   void PrintStats() const;
+
+  /// \brief Print, for each Decl, Stmt and Type class, the number of objects
+  /// and bytes allocated, followed by the AST allocator's slab count, total
+  /// size and the bytes wasted at the tail of abandoned slabs.
+  void PrintMemoryStats(raw_ostream &OS) const;
+
   const SmallVectorImpl<Type *>& getTypes() const { return Types; }
 
   /// \brief Create a new implicit TU-level CXXRecordDecl or RecordDecl
@@ -1604,6 +1604,22 @@ public:
   /// \brief Ensure the lookup structure is fully-built and return it.
   StoredDeclsMap *buildLookup();
 
+  /// \brief Add an immutable sorted table to the lookup structure.
+  ///
+  /// This should be called only on primary contexts that will not gain
+  /// further declarations, such as completed classes and contexts whose
+  /// external visible storage has been fully loaded. lookup() consults the
+  /// frozen table directly. The StoredDeclsMap stays populated, so
+  /// noload_lookups(), lookups() and other walkers of getLookupPtr() still
+  /// see every name. Adding a declaration or calling buildLookup() thaws the
+  /// context, discarding the frozen table.
+  ///
+  /// \returns true if the table was frozen.
+  bool freezeLookupTable();
+
+  /// \brief Whether lookups in this context are served by a frozen table.
+  bool hasFrozenLookupTable() const;
+
   /// \brief Whether this DeclContext has external storage containing
   /// additional declarations that are lexically in this context.
   bool hasExternalLexicalStorage() const { return ExternalLexicalStorage; }
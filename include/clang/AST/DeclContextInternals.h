@@ -238,16 +238,74 @@ public:
   }
 };
 
+/// \brief An immutable lookup table for a declaration context that is no
+/// longer changing.
+///
+/// Names are kept in a single array sorted by the opaque value of their
+/// DeclarationName, and the declarations for all names are stored
+/// contiguously in a second array, so a lookup is one binary search over
+/// adjacent memory instead of a probe into a hash table whose buckets each
+/// own a separate vector. Both arrays are allocated from the ASTContext.
+class FrozenDeclsTable {
+public:
+  struct Entry {
+    DeclarationName Name;
+    unsigned FirstDecl;
+    unsigned NumDecls;
+  };
+
+private:
+  Entry *Entries;
+  unsigned NumEntries;
+  NamedDecl **Decls;
+
+  struct EntryLess {
+    bool operator()(const Entry &E, DeclarationName Name) const {
+      return E.Name.getAsOpaqueInteger() < Name.getAsOpaqueInteger();
+    }
+  };
+
+public:
+  FrozenDeclsTable() : Entries(0), NumEntries(0), Decls(0) {}
+
+  /// \brief Build a table from the names in \p Map, all of which must be
+  /// fully loaded.
+  static FrozenDeclsTable *Create(ASTContext &C, const StoredDeclsMap &Map);
+
+  /// \brief Find the declarations for \p Name, if any.
+  DeclContextLookupResult lookup(DeclarationName Name) const {
+    const Entry *E = std::lower_bound(Entries, Entries + NumEntries, Name,
+                                      EntryLess());
+    if (E == Entries + NumEntries || E->Name != Name)
+      return DeclContextLookupResult();
+    return DeclContextLookupResult(Decls + E->FirstDecl, E->NumDecls);
+  }
+
+  ArrayRef<Entry> entries() const {
+    return ArrayRef<Entry>(Entries, NumEntries);
+  }
+};
+
 class StoredDeclsMap
   : public llvm::SmallDenseMap<DeclarationName, StoredDeclsList, 4> {
 
 public:
+  StoredDeclsMap() : Frozen(0) {}
+
   static void DestroyAll(StoredDeclsMap *Map, bool Dependent);
 
+  /// \brief The compact form of this map, once the context has been frozen
+  /// by DeclContext::freezeLookupTable. Lookups are then answered from the
+  /// frozen table. The hash table keeps its entries, since everything that
+  /// iterates the map (all_lookups_iterator, ASTWriter, ...) walks it
+  /// directly.
+  FrozenDeclsTable *getFrozenTable() const { return Frozen; }
+
 private:
   friend class ASTContext; // walks the chain deleting these
   friend class DeclContext;
   llvm::PointerIntPair<StoredDeclsMap*, 1> Previous;
+  FrozenDeclsTable *Frozen;
 };
 
 class DependentStoredDeclsMap : public StoredDeclsMap {
@@ -0,0 +1,137 @@
+//===--- ParallelASTTraversal.h - Parallel AST traversal --------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+//  This file defines traverseTopLevelDeclsInParallel, which visits the
+//  top-level declarations of a translation unit on several threads, each with
+//  its own visitor instance.
+//
+//  Thread safety. While a parallel traversal is running, visitors may:
+//
+//   - call const accessors of Decl, Stmt, Expr, Type and QualType that only
+//     read fields of the node, such as getType(), getBody(), children(),
+//     getCanonicalType(), getAs<T>() and getDeclName();
+//   - call ASTContext methods that only read existing state, such as
+//     getLangOpts(), getTargetInfo(), getTranslationUnitDecl(),
+//     getPrintingPolicy() and getDiagnostics();
+//   - keep SourceLocations and SourceRanges to resolve later.
+//
+//  They must not:
+//
+//   - create AST nodes, types or template arguments, or call any ASTContext
+//     method that may do so (getPointerType(), getTypeDeclType(), ...);
+//   - call ASTContext methods that fill internal caches, including
+//     getTypeInfo(), getTypeSize(), getASTRecordLayout(),
+//     getObjCLayout() and getCommentForDecl();
+//   - query the SourceManager, whose lookup caches are not synchronized;
+//     record the locations and resolve them after the traversal instead;
+//   - emit diagnostics through the shared DiagnosticsEngine.
+//
+//  Traversal falls back to a single thread when the ASTContext has an
+//  external source, since visiting a declaration may deserialize others.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_AST_PARALLELASTTRAVERSAL_H
+#define LLVM_CLANG_AST_PARALLELASTTRAVERSAL_H
+
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/Decl.h"
+#include "llvm/ADT/ArrayRef.h"
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace clang {
+
+/// \brief The top-level declarations of \p TU, split into at most
+/// \p NumRanges contiguous ranges of roughly equal size.
+///
+/// Declarations are collected before any range is visited, so iterating the
+/// translation unit's lexical declaration list never races with traversal.
+class TopLevelDeclRanges {
+  std::vector<Decl *> Decls;
+  std::vector<ArrayRef<Decl *> > Ranges;
+
+public:
+  TopLevelDeclRanges(TranslationUnitDecl *TU, unsigned NumRanges) {
+    for (DeclContext::decl_iterator I = TU->decls_begin(),
+                                    E = TU->decls_end();
+         I != E; ++I)
+      Decls.push_back(*I);
+
+    if (NumRanges == 0)
+      NumRanges = 1;
+    size_t PerRange = (Decls.size() + NumRanges - 1) / NumRanges;
+    for (size_t Begin = 0; Begin < Decls.size(); Begin += PerRange) {
+      size_t Length = std::min(PerRange, Decls.size() - Begin);
+      Ranges.push_back(ArrayRef<Decl *>(&Decls[Begin], Length));
+    }
+  }
+
+  unsigned size() const { return Ranges.size(); }
+  ArrayRef<Decl *> operator[](unsigned I) const { return Ranges[I]; }
+};
+
+/// \brief Visit every top-level declaration of the translation unit in
+/// \p Ctx, spreading the declarations over \p NumThreads threads.
+///
+/// \p MakeVisitor is called once per range, on the calling thread, and must
+/// return a new \c VisitorT (typically a DataRecursiveASTVisitor or
+/// RecursiveASTVisitor subclass). Each visitor sees one contiguous range of
+/// declarations, in source order, via TraverseDecl.
+///
+/// \param NumThreads The number of threads to use; 0 selects one per
+/// hardware thread.
+///
+/// \returns the visitors, in range order, so their results can be merged.
+template <typename VisitorT, typename FactoryT>
+std::vector<std::unique_ptr<VisitorT> >
+traverseTopLevelDeclsInParallel(ASTContext &Ctx, unsigned NumThreads,
+                                FactoryT MakeVisitor) {
+  if (NumThreads == 0)
+    NumThreads = std::max(1u, std::thread::hardware_concurrency());
+  if (Ctx.getExternalSource())
+    NumThreads = 1;
+
+  TopLevelDeclRanges Ranges(Ctx.getTranslationUnitDecl(), NumThreads);
+  std::vector<std::unique_ptr<VisitorT> > Visitors;
+  for (unsigned I = 0, N = Ranges.size(); I != N; ++I)
+    Visitors.push_back(std::unique_ptr<VisitorT>(MakeVisitor()));
+
+  struct Worker {
+    static void run(VisitorT &V, ArrayRef<Decl *> Range) {
+      for (ArrayRef<Decl *>::iterator I = Range.begin(), E = Range.end();
+           I != E; ++I)
+        V.TraverseDecl(*I);
+    }
+  };
+
+  if (Ranges.size() <= 1) {
+    if (Ranges.size() == 1)
+      Worker::run(*Visitors[0], Ranges[0]);
+    return Visitors;
+  }
+
+  // The calling thread takes the first range itself.
+  std::vector<std::thread> Threads;
+  for (unsigned I = 1, N = Ranges.size(); I != N; ++I)
+    Threads.push_back(std::thread(&Worker::run, std::ref(*Visitors[I]),
+                                  Ranges[I]));
+  Worker::run(*Visitors[0], Ranges[0]);
+  for (unsigned I = 0, N = Threads.size(); I != N; ++I)
+    Threads[I].join();
+
+  return Visitors;
+}
+
+} // end namespace clang
+
+#endif
@@ -166,6 +166,19 @@ public:
   /// \brief Finds all matches in the given AST.
   void matchAST(ASTContext &Context);
 
+  /// \brief Finds all matches in the given AST, splitting its top-level
+  /// declarations among \p NumThreads threads.
+  ///
+  /// A value of 0 for \p NumThreads uses one thread per hardware thread.
+  /// Each thread records its matches instead of reporting them. When all
+  /// threads are done, the matches are reported on the calling thread in
+  /// the order \c matchAST() would report them. This means callbacks do not
+  /// have to be thread-safe, and the output does not depend on scheduling.
+  ///
+  /// The parent map of \p Context is built before the threads start, so
+  /// \c hasParent() and \c hasAncestor() can be used freely.
+  void matchASTParallel(ASTContext &Context, unsigned NumThreads = 0);
+
   /// \brief Registers a callback to notify the end of parsing.
   ///
   /// The provided closure is called after parsing is done, before the AST is
@@ -179,6 +192,13 @@ private:
   std::vector<std::pair<internal::DynTypedMatcher, MatchCallback *> >
     MatcherCallbackPairs;
 
+  /// \brief Indices into \c MatcherCallbackPairs, by the restrict kind of
+  /// the matcher. Filled in by the addMatcher() overloads so that traversal
+  /// only tries, on each node, the matchers whose restrict kind is the kind
+  /// of the node or one of its bases.
+  std::map<ast_type_traits::ASTNodeKind, std::vector<unsigned> >
+    MatchersByRestrictKind;
+
   /// \brief Called when parsing is done.
   ParsingDoneTestCallback *ParsingDone;
 };
@@ -178,8 +178,29 @@ public:
   virtual bool matches(const T &Node,
                        ASTMatchFinder *Finder,
                        BoundNodesTreeBuilder *Builder) const = 0;
+
+  /// \brief Returns the most derived kind a node must have for \c matches()
+  /// to possibly return true.
+  ///
+  /// \c MatchFinder only tries a top-level matcher on nodes of its restrict
+  /// kind, so matchers that wrap others should forward it when they cannot
+  /// match anything their inner matcher does not.
+  virtual ast_type_traits::ASTNodeKind getRestrictKind() const {
+    return ast_type_traits::ASTNodeKind::getFromNodeKind<T>();
+  }
 };
 
+/// \brief Returns the more derived of \p A and \p B. A node must be of both
+/// kinds to match matchers restricted to each, so for unrelated kinds, where
+/// nothing can match, either is a correct answer.
+inline ast_type_traits::ASTNodeKind
+getMostDerivedKind(ast_type_traits::ASTNodeKind A,
+                   ast_type_traits::ASTNodeKind B) {
+  if (A.isSame(ast_type_traits::ASTNodeKind()) || A.isBaseOf(B))
+    return B;
+  return A;
+}
+
 /// \brief Interface for matchers that only evaluate properties on a single
 /// node.
 template <typename T>
@@ -253,6 +274,11 @@ public:
     return reinterpret_cast<uint64_t>(Implementation.getPtr());
   }
 
+  /// \brief See \c MatcherInterface::getRestrictKind().
+  ast_type_traits::ASTNodeKind getRestrictKind() const {
+    return Implementation->getRestrictKind();
+  }
+
   /// \brief Allows the conversion of a \c Matcher<Type> to a \c
   /// Matcher<QualType>.
   ///
@@ -289,6 +315,12 @@ private:
       return From.matches(Node, Finder, Builder);
     }
 
+    ast_type_traits::ASTNodeKind getRestrictKind() const override {
+      return getMostDerivedKind(
+          ast_type_traits::ASTNodeKind::getFromNodeKind<T>(),
+          From.getRestrictKind());
+    }
+
   private:
     const Matcher<Base> From;
   };
@@ -346,6 +378,12 @@ public:
     return Storage->getSupportedKind();
   }
 
+  /// \brief Returns the most derived kind a node must have for this matcher
+  /// to match, which is the supported kind or a kind derived from it.
+  ast_type_traits::ASTNodeKind getRestrictKind() const {
+    return Storage->getRestrictKind();
+  }
+
   /// \brief Returns \c true if the passed \c DynTypedMatcher can be converted
   ///   to a \c Matcher<T>.
   ///
@@ -375,8 +413,9 @@ public:
 private:
   class MatcherStorage : public RefCountedBaseVPTR {
   public:
-    MatcherStorage(ast_type_traits::ASTNodeKind SupportedKind, uint64_t ID)
-        : SupportedKind(SupportedKind), ID(ID) {}
+    MatcherStorage(ast_type_traits::ASTNodeKind SupportedKind,
+                   ast_type_traits::ASTNodeKind RestrictKind, uint64_t ID)
+        : SupportedKind(SupportedKind), RestrictKind(RestrictKind), ID(ID) {}
     virtual ~MatcherStorage();
 
     virtual bool matches(const ast_type_traits::DynTypedNode DynNode,
@@ -389,10 +428,15 @@ private:
       return SupportedKind;
     }
 
+    ast_type_traits::ASTNodeKind getRestrictKind() const {
+      return RestrictKind;
+    }
+
     uint64_t getID() const { return ID; }
 
   private:
     const ast_type_traits::ASTNodeKind SupportedKind;
+    const ast_type_traits::ASTNodeKind RestrictKind;
     const uint64_t ID;
   };
 
@@ -407,7 +451,7 @@ class DynTypedMatcher::TypedMatcherStorage : public MatcherStorage {
 public:
   TypedMatcherStorage(const Matcher<T> &Other, bool AllowBind)
       : MatcherStorage(ast_type_traits::ASTNodeKind::getFromNodeKind<T>(),
-                       Other.getID()),
+                       Other.getRestrictKind(), Other.getID()),
         InnerMatcher(Other), AllowBind(AllowBind) {}
 
   bool matches(const ast_type_traits::DynTypedNode DynNode,
@@ -1010,6 +1054,10 @@ public:
     return Result;
   }
 
+  ast_type_traits::ASTNodeKind getRestrictKind() const override {
+    return InnerMatcher.getRestrictKind();
+  }
+
 private:
   const std::string ID;
   const Matcher<T> InnerMatcher;
@@ -1109,6 +1157,8 @@ public:
                 InnerMatchers);
   }
 
+  ast_type_traits::ASTNodeKind getRestrictKind() const override;
+
 private:
   const VariadicOperatorFunction Func;
   const std::vector<DynTypedMatcher> InnerMatchers;
@@ -1225,6 +1275,20 @@ bool AllOfVariadicOperator(const ast_type_traits::DynTypedNode DynNode,
                            BoundNodesTreeBuilder *Builder,
                            ArrayRef<DynTypedMatcher> InnerMatchers);
 
+/// \brief An allOf() matches only nodes of the restrict kinds of all of its
+/// inner matchers; other operators are not restricted beyond \c T.
+template <typename T>
+ast_type_traits::ASTNodeKind
+VariadicOperatorMatcherInterface<T>::getRestrictKind() const {
+  ast_type_traits::ASTNodeKind Kind =
+      ast_type_traits::ASTNodeKind::getFromNodeKind<T>();
+  if (Func != AllOfVariadicOperator)
+    return Kind;
+  for (size_t I = 0, E = InnerMatchers.size(); I != E; ++I)
+    Kind = getMostDerivedKind(Kind, InnerMatchers[I].getRestrictKind());
+  return Kind;
+}
+
 /// \brief Matches nodes for which at least one of the provided matchers
 /// matches, but doesn't stop at the first match.
 bool EachOfVariadicOperator(const ast_type_traits::DynTypedNode DynNode,
@@ -0,0 +1,96 @@
+//===--- QuerySession.h - Dynamic matchers over cached ASTs -----*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief Runs matcher expressions against a set of ASTs loaded once.
+///
+/// A query session owns the \c ASTUnit of every translation unit it was
+/// given, so an interactive tool pays for parsing once and then answers
+/// each query in the time it takes to traverse the ASTs:
+///
+/// \code
+///   std::vector<ASTUnit *> ASTs;
+///   Tool.buildASTs(ASTs);
+///   QuerySession QS(ASTs);
+///   Diagnostics Diag;
+///   if (!QS.runQuery("recordDecl(hasName(\"Foo\")).bind(\"r\")", llvm::outs(),
+///                    &Diag))
+///     Diag.printToStreamFull(llvm::errs());
+/// \endcode
+///
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_AST_MATCHERS_DYNAMIC_QUERY_SESSION_H
+#define LLVM_CLANG_AST_MATCHERS_DYNAMIC_QUERY_SESSION_H
+
+#include "clang/ASTMatchers/Dynamic/Diagnostics.h"
+#include "clang/Basic/LLVM.h"
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/StringRef.h"
+#include <vector>
+
+namespace llvm {
+class raw_ostream;
+}
+
+namespace clang {
+
+class ASTUnit;
+
+namespace ast_matchers {
+namespace dynamic {
+
+/// \brief The set of ASTs a query tool runs its queries against.
+class QuerySession {
+public:
+  /// \brief How each match is reported by \c runQuery().
+  enum OutputKind {
+    OK_Diag,  ///< A "root" note at each bound node, with its source range.
+    OK_Print, ///< The pretty-printed source of each bound node.
+    OK_Dump   ///< The AST dump of each bound node.
+  };
+
+  /// \brief Takes ownership of \p ASTs.
+  explicit QuerySession(ArrayRef<ASTUnit *> ASTs);
+  ~QuerySession();
+
+  ArrayRef<ASTUnit *> getASTs() const { return ASTs; }
+
+  void setOutputKind(OutputKind Kind) { Output = Kind; }
+  OutputKind getOutputKind() const { return Output; }
+
+  /// \brief Set the number of threads \c runQuery() matches on.
+  ///
+  /// Each thread takes whole ASTs. Matches are still printed in the order of
+  /// the ASTs, so the output is the same for any number of threads. A value
+  /// of 0 uses one thread per hardware thread.
+  void setNumThreads(unsigned N) { NumThreads = N; }
+
+  /// \brief Parses \p MatcherExpr and prints every match in every AST to
+  /// \p OS, followed by the number of matches.
+  ///
+  /// \return \c false, with the reason in \p Error, if \p MatcherExpr is not
+  ///   a valid top-level matcher.
+  bool runQuery(StringRef MatcherExpr, llvm::raw_ostream &OS,
+                Diagnostics *Error);
+
+private:
+  QuerySession(const QuerySession &) LLVM_DELETED_FUNCTION;
+  void operator=(const QuerySession &) LLVM_DELETED_FUNCTION;
+
+  std::vector<ASTUnit *> ASTs;
+  OutputKind Output;
+  unsigned NumThreads;
+};
+
+}  // namespace dynamic
+}  // namespace ast_matchers
+}  // namespace clang
+
+#endif  // LLVM_CLANG_AST_MATCHERS_DYNAMIC_QUERY_SESSION_H
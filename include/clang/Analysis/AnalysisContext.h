@@ -25,6 +25,7 @@
 namespace clang {
 
 class Stmt;
+class CFGCache;
 class CFGReverseBlockReachabilityAnalysis;
 class CFGStmtMap;
 class LiveVariables;
@@ -86,6 +87,9 @@ class AnalysisDeclContext {
 
   void *ManagedAnalyses;
 
+  /// The cache from which to take this context's CFGs, if any. Not owned.
+  CFGCache *SharedCFGs;
+
 public:
   AnalysisDeclContext(AnalysisDeclContextManager *Mgr,
                   const Decl *D);
@@ -143,8 +147,19 @@ public:
   /// \sa getBody
   bool isBodyAutosynthesized() const;
 
+  /// \brief Return the CFG, building it on first use.
+  ///
+  /// If a shared CFGCache has been set and the build options allow it, the
+  /// CFG is taken from the cache, and stays owned by it.
   CFG *getCFG();
 
+  /// \brief Share CFGs with other clients through \p Cache. Must be set
+  /// before the first call to getCFG or getUnoptimizedCFG.
+  void setSharedCFGCache(CFGCache *Cache) {
+    assert(!builtCFG && !builtCompleteCFG && "CFG already built");
+    SharedCFGs = Cache;
+  }
+
   CFGStmtMap *getCFGStmtMap();
 
   CFGReverseBlockReachabilityAnalysis *getCFGReachablityAnalysis();
@@ -403,6 +418,9 @@ class AnalysisDeclContextManager {
   /// for well-known functions.
   bool SynthesizeBodies;
 
+  /// The cache handed to every context this manager creates. Not owned.
+  CFGCache *SharedCFGs;
+
 public:
   AnalysisDeclContextManager(bool useUnoptimizedCFG = false,
                              bool addImplicitDtors = false,
@@ -428,6 +446,10 @@ public:
   /// functions.
   bool synthesizeBodies() const { return SynthesizeBodies; }
 
+  /// Share the CFGs of contexts created from now on through \p Cache.
+  void setSharedCFGCache(CFGCache *Cache) { SharedCFGs = Cache; }
+  CFGCache *getSharedCFGCache() const { return SharedCFGs; }
+
   const StackFrameContext *getStackFrame(AnalysisDeclContext *Ctx,
                                          LocationContext const *Parent,
                                          const Stmt *S,
@@ -739,6 +739,10 @@ public:
       return alwaysAddMask[stmt->getStmtClass()];
     }
 
+    bool alwaysAdd(Stmt::StmtClass stmtClass) const {
+      return alwaysAddMask[stmtClass];
+    }
+
     BuildOptions &setAlwaysAdd(Stmt::StmtClass stmtClass, bool val = true) {
       alwaysAddMask[stmtClass] = val;
       return *this;
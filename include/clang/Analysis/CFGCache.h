@@ -0,0 +1,138 @@
+//===--- CFGCache.h - CFGs shared between analysis clients ------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+//  This file defines CFGCache, which lets the CFGs built for analysis-based
+//  warnings be reused by the static analyzer instead of being rebuilt.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_ANALYSIS_CFGCACHE_H
+#define LLVM_CLANG_ANALYSIS_CFGCACHE_H
+
+#include "clang/Analysis/CFG.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/FoldingSet.h"
+#include <bitset>
+
+namespace clang {
+
+class Decl;
+
+/// \brief Owns CFGs keyed by declaration, body and the build options that
+/// shaped them.
+///
+/// Two clients that ask for the CFG of the same declaration and body with
+/// equal CFG::BuildOptions get the same CFG. Options that carry per-client
+/// state (forced block expressions or a CFGCallback observer) are never
+/// cached, since the CFG they produce is specific to that client.
+///
+/// Analyses derived from a CFG (CFGStmtMap, LiveVariables,
+/// PostOrderCFGView, ...) remain per AnalysisDeclContext and are built
+/// lazily through AnalysisDeclContext::getAnalysis, so sharing a CFG never
+/// forces them to be computed.
+class CFGCache {
+  /// \brief The declaration and body a CFG was built from, and every build
+  /// option that can change it.
+  struct Key {
+    const Decl *D;
+    const Stmt *Body;
+    unsigned Flags;
+    std::bitset<Stmt::lastStmtConstant> AlwaysAdd;
+    unsigned Hash;
+  };
+  struct KeyInfo {
+    static Key getEmptyKey() {
+      Key K;
+      K.D = llvm::DenseMapInfo<const Decl *>::getEmptyKey();
+      K.Body = 0;
+      K.Flags = 0;
+      K.Hash = 0;
+      return K;
+    }
+    static Key getTombstoneKey() {
+      Key K = getEmptyKey();
+      K.D = llvm::DenseMapInfo<const Decl *>::getTombstoneKey();
+      return K;
+    }
+    static unsigned getHashValue(const Key &K) { return K.Hash; }
+    static bool isEqual(const Key &LHS, const Key &RHS) {
+      return LHS.D == RHS.D && LHS.Body == RHS.Body &&
+             LHS.Flags == RHS.Flags && LHS.AlwaysAdd == RHS.AlwaysAdd;
+    }
+  };
+
+  /// \brief The cached CFGs; a null entry records that building failed.
+  llvm::DenseMap<Key, CFG *, KeyInfo> CFGs;
+
+  unsigned NumHits, NumMisses;
+
+  CFGCache(const CFGCache &) LLVM_DELETED_FUNCTION;
+  void operator=(const CFGCache &) LLVM_DELETED_FUNCTION;
+
+  static Key makeKey(const Decl *D, const Stmt *Body,
+                     const CFG::BuildOptions &BO) {
+    Key K;
+    K.D = D;
+    K.Body = Body;
+    K.Flags = BO.PruneTriviallyFalseEdges | BO.AddEHEdges << 1 |
+              BO.AddInitializers << 2 | BO.AddImplicitDtors << 3 |
+              BO.AddTemporaryDtors << 4 | BO.AddStaticInitBranches << 5 |
+              BO.AddCXXNewAllocator << 6;
+    llvm::FoldingSetNodeID ID;
+    ID.AddPointer(D);
+    ID.AddPointer(Body);
+    ID.AddInteger(K.Flags);
+    for (unsigned I = 0; I != Stmt::lastStmtConstant; ++I) {
+      bool Add = BO.alwaysAdd(static_cast<Stmt::StmtClass>(I));
+      K.AlwaysAdd[I] = Add;
+      ID.AddBoolean(Add);
+    }
+    K.Hash = ID.ComputeHash();
+    return K;
+  }
+
+public:
+  CFGCache() : NumHits(0), NumMisses(0) {}
+  ~CFGCache() {
+    for (llvm::DenseMap<Key, CFG *, KeyInfo>::iterator I = CFGs.begin(),
+                                                       E = CFGs.end();
+         I != E; ++I)
+      delete I->second;
+  }
+
+  /// \brief Whether a CFG built with \p BO may be shared.
+  static bool isCacheable(const CFG::BuildOptions &BO) {
+    return !BO.forcedBlkExprs && !BO.Observer;
+  }
+
+  /// \brief Return the CFG of \p D built with \p BO, building and caching it
+  /// on first use. Returns null if the CFG could not be built. The cache
+  /// keeps ownership of the result.
+  CFG *getOrBuild(const Decl *D, Stmt *Body, ASTContext &Ctx,
+                  const CFG::BuildOptions &BO) {
+    assert(isCacheable(BO) && "options carry per-client state");
+    Key K = makeKey(D, Body, BO);
+    std::pair<llvm::DenseMap<Key, CFG *, KeyInfo>::iterator, bool> R =
+        CFGs.insert(std::make_pair(K, (CFG *)0));
+    if (!R.second) {
+      ++NumHits;
+      return R.first->second;
+    }
+    ++NumMisses;
+    R.first->second = CFG::buildCFG(D, Body, &Ctx, BO);
+    return R.first->second;
+  }
+
+  unsigned getNumHits() const { return NumHits; }
+  unsigned getNumMisses() const { return NumMisses; }
+};
+
+} // end clang namespace
+
+#endif
@@ -0,0 +1,180 @@
+//===--- BitVectorDataflow.h - Worklist solver over bit vectors -*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file defines BitVectorDataflowSolver, a worklist solver for gen/kill
+// style dataflow problems whose facts are numbered densely, such as the
+// liveness of local variables or their initialization state.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_ANALYSIS_BITVECTORDATAFLOW_H
+#define LLVM_CLANG_ANALYSIS_BITVECTORDATAFLOW_H
+
+#include "clang/Analysis/Analyses/PostOrderCFGView.h"
+#include "clang/Analysis/CFG.h"
+#include "llvm/ADT/BitVector.h"
+#include "llvm/ADT/SparseBitVector.h"
+#include <algorithm>
+#include <vector>
+
+namespace clang {
+
+/// \brief How the values flowing into a block are combined.
+enum DataflowMeetKind {
+  DMK_Union,        ///< A fact holds if it holds on any incoming edge.
+  DMK_Intersection  ///< A fact holds if it holds on every incoming edge.
+};
+
+/// \brief Solves a dataflow problem over the blocks of a CFG.
+///
+/// \p AnalysisT describes the problem and must provide:
+///
+/// \code
+///   static const bool IsBackward;             // Direction of the analysis.
+///   static const DataflowMeetKind Meet;
+///   // Value at the entry (or, if backward, exit) of the function.
+///   void initBoundary(ValueT &V);
+///   // Identity of the meet: no facts for a union, every fact for an
+///   // intersection. Used for blocks none of whose inputs were reached yet.
+///   void initIdentity(ValueT &V);
+///   // Apply the block's effect to V, in the direction of the analysis.
+///   void transferBlock(const CFGBlock *B, ValueT &V);
+/// \endcode
+///
+/// \p ValueT is the set of facts: llvm::BitVector for problems where most
+/// facts are relevant to most blocks, llvm::SparseBitVector<> when facts are
+/// numerous but each block touches few of them (e.g. thousands of locals in
+/// generated code). Both are used only through |=, &= and ==.
+///
+/// Blocks are ranked by reverse post order (post order for backward
+/// problems) and the pending block of lowest rank is always processed
+/// next. Inner loops thus reach their fixed point before the blocks after
+/// them are revisited, which keeps the number of block visits close to
+/// linear for reducible CFGs.
+template <typename AnalysisT, typename ValueT = llvm::BitVector>
+class BitVectorDataflowSolver {
+  const CFG &G;
+  AnalysisT &Analysis;
+
+  /// Blocks in processing order, and each block's position in it.
+  std::vector<const CFGBlock *> Order;
+  std::vector<unsigned> Rank;
+
+  /// Values before and after each block, in the direction of the analysis,
+  /// indexed by block ID.
+  std::vector<ValueT> In, Out;
+  llvm::BitVector Visited;
+
+  unsigned NumBlockVisits;
+
+  void joinInto(ValueT &Dst, const ValueT &Src, bool &First) {
+    if (First) {
+      Dst = Src;
+      First = false;
+    } else if (AnalysisT::Meet == DMK_Union) {
+      Dst |= Src;
+    } else {
+      Dst &= Src;
+    }
+  }
+
+  template <typename IterT>
+  void enqueueAll(IterT I, IterT E, llvm::BitVector &Pending) {
+    for (; I != E; ++I) {
+      // Blocks missing from the post order are unreachable.
+      const CFGBlock *B = *I;
+      if (B && Rank[B->getBlockID()] != ~0U)
+        Pending.set(Rank[B->getBlockID()]);
+    }
+  }
+
+public:
+  BitVectorDataflowSolver(const CFG &G, PostOrderCFGView &POV,
+                          AnalysisT &Analysis)
+    : G(G), Analysis(Analysis), Rank(G.getNumBlockIDs(), ~0U),
+      In(G.getNumBlockIDs()), Out(G.getNumBlockIDs()),
+      Visited(G.getNumBlockIDs()), NumBlockVisits(0) {
+    for (PostOrderCFGView::iterator I = POV.begin(), E = POV.end(); I != E;
+         ++I)
+      Order.push_back(*I);
+    if (AnalysisT::IsBackward)
+      std::reverse(Order.begin(), Order.end());
+    for (unsigned I = 0, E = Order.size(); I != E; ++I)
+      Rank[Order[I]->getBlockID()] = I;
+  }
+
+  /// \brief Run the analysis to a fixed point.
+  void solve() {
+    llvm::BitVector Pending(Order.size(), true);
+    const CFGBlock *Boundary = AnalysisT::IsBackward ? &G.getExit()
+                                                     : &G.getEntry();
+
+    for (int R = Pending.find_first(); R != -1; R = Pending.find_first()) {
+      Pending.reset(R);
+      const CFGBlock *B = Order[R];
+      unsigned ID = B->getBlockID();
+      ++NumBlockVisits;
+
+      ValueT V;
+      if (B == Boundary) {
+        Analysis.initBoundary(V);
+      } else {
+        bool First = true;
+        if (AnalysisT::IsBackward) {
+          for (CFGBlock::const_succ_iterator I = B->succ_begin(),
+                                             E = B->succ_end();
+               I != E; ++I)
+            if (*I && Visited.test((*I)->getBlockID()))
+              joinInto(V, Out[(*I)->getBlockID()], First);
+        } else {
+          for (CFGBlock::const_pred_iterator I = B->pred_begin(),
+                                             E = B->pred_end();
+               I != E; ++I)
+            if (*I && Visited.test((*I)->getBlockID()))
+              joinInto(V, Out[(*I)->getBlockID()], First);
+        }
+        if (First)
+          Analysis.initIdentity(V);
+      }
+      In[ID] = V;
+      Analysis.transferBlock(B, V);
+
+      if (Visited.test(ID) && V == Out[ID])
+        continue;
+      Visited.set(ID);
+      Out[ID] = V;
+      if (AnalysisT::IsBackward)
+        enqueueAll(B->pred_begin(), B->pred_end(), Pending);
+      else
+        enqueueAll(B->succ_begin(), B->succ_end(), Pending);
+    }
+  }
+
+  /// \brief The value flowing into \p B, in the direction of the analysis:
+  /// at its entry for forward problems, at its exit for backward ones.
+  const ValueT &getBlockInput(const CFGBlock *B) const {
+    return In[B->getBlockID()];
+  }
+
+  /// \brief The value flowing out of \p B, in the direction of the analysis.
+  const ValueT &getBlockOutput(const CFGBlock *B) const {
+    return Out[B->getBlockID()];
+  }
+
+  /// \brief Whether \p B was reached by the analysis.
+  bool wasVisited(const CFGBlock *B) const {
+    return Visited.test(B->getBlockID());
+  }
+
+  unsigned getNumBlockVisits() const { return NumBlockVisits; }
+};
+
+} // end namespace clang
+
+#endif
@@ -9,6 +9,9 @@
 //
 // This file defines skeleton code for implementing dataflow analyses.
 //
+// New analyses whose facts can be numbered should use
+// BitVectorDataflowSolver (BitVectorDataflow.h) instead.
+//
 //===----------------------------------------------------------------------===//
 
 #ifndef LLVM_CLANG_ANALYSES_DATAFLOW_SOLVER
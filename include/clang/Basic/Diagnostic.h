@@ -19,6 +19,7 @@
 #include "clang/Basic/DiagnosticOptions.h"
 #include "clang/Basic/SourceLocation.h"
 #include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/BitVector.h"
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/IntrusiveRefCntPtr.h"
 #include <list>
@@ -280,6 +281,17 @@ private:
   /// the given source location.
   DiagStatePointsTy::iterator GetDiagStatePointForLoc(SourceLocation Loc) const;
 
+  /// \brief The diagnostics known to be ignored at every source location,
+  /// indexed by diagnostic ID.
+  ///
+  /// DiagnosticIDs sets a bit when it finds a diagnostic mapped to ignore in
+  /// every DiagState, after which getDiagnosticLevel answers without looking
+  /// up the state for the location. Any change that could make an ignored
+  /// diagnostic visible again clears the set.
+  mutable llvm::BitVector IgnoredEverywhere;
+
+  void invalidateIgnoredEverywhere() { IgnoredEverywhere.clear(); }
+
   /// \brief Sticky flag set to \c true when an error is emitted.
   bool ErrorOccurred;
 
@@ -431,14 +443,20 @@ public:
   /// \brief When set to true, any unmapped warnings are ignored.
   ///
   /// If this and WarningsAsErrors are both set, then this one wins.
-  void setIgnoreAllWarnings(bool Val) { IgnoreAllWarnings = Val; }
+  void setIgnoreAllWarnings(bool Val) {
+    IgnoreAllWarnings = Val;
+    invalidateIgnoredEverywhere();
+  }
   bool getIgnoreAllWarnings() const { return IgnoreAllWarnings; }
 
   /// \brief When set to true, any unmapped ignored warnings are no longer
   /// ignored.
   ///
   /// If this and IgnoreAllWarnings are both set, then that one wins.
-  void setEnableAllWarnings(bool Val) { EnableAllWarnings = Val; }
+  void setEnableAllWarnings(bool Val) {
+    EnableAllWarnings = Val;
+    invalidateIgnoredEverywhere();
+  }
   bool getEnableAllWarnings() const { return EnableAllWarnings; }
 
   /// \brief When set to true, any warnings reported are issued as errors.
@@ -508,6 +526,7 @@ public:
   /// This corresponds to the GCC -pedantic and -pedantic-errors option.
   void setExtensionHandlingBehavior(ExtensionHandling H) {
     ExtBehavior = H;
+    invalidateIgnoredEverywhere();
   }
   ExtensionHandling getExtensionHandlingBehavior() const { return ExtBehavior; }
 
@@ -634,7 +653,12 @@ public:
   ///
   /// \param Loc The source location we are interested in finding out the
   /// diagnostic state. Can be null in order to query the latest state.
+  ///
+  /// A diagnostic that is ignored everywhere, as most disabled warnings are,
+  /// is classified without a source location lookup.
   Level getDiagnosticLevel(unsigned DiagID, SourceLocation Loc) const {
+    if (DiagID < IgnoredEverywhere.size() && IgnoredEverywhere[DiagID])
+      return Ignored;
     return (Level)Diags->getDiagnosticLevel(DiagID, Loc, *this);
   }
 
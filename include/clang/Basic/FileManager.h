@@ -258,6 +258,14 @@ public:
   /// \brief Remove the real file \p Entry from the cache.
   void invalidateCache(const FileEntry *Entry);
 
+  /// \brief Re-stat every real file in the cache and drop the entries whose
+  /// size or modification time no longer match the file on disk.
+  ///
+  /// This lets a long-lived FileManager be reused across compilations.
+  ///
+  /// \returns the number of entries that were invalidated.
+  unsigned invalidateStaleFiles();
+
   /// \brief If path is not absolute and FileSystemOptions set the working
   /// directory, the path is modified to be relative to the given
   /// working directory.
@@ -25,6 +25,10 @@ public:
   /// \brief If set, paths are resolved as if the working directory was
   /// set to the value of WorkingDir.
   std::string WorkingDir;
+
+  /// \brief If set, the path of a stat cache file shared between compiler
+  /// processes (see \c PersistentStatCache).
+  std::string StatCachePath;
 };
 
 } // end namespace clang
@@ -18,6 +18,7 @@
 #include "clang/Basic/LLVM.h"
 #include "llvm/ADT/StringMap.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include <memory>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -117,6 +118,64 @@ public:
                        vfs::File **F, vfs::FileSystem &FS) override;
 };
 
+/// \brief A stat cache stored in a memory-mapped file and shared by every
+/// compiler process using the same cache file.
+///
+/// Each entry records the result of a stat() call together with the
+/// modification time of the directory containing the path at the time of
+/// the call. An entry is only trusted if that directory is unchanged, which
+/// is checked at most once per directory and process, so lookups of
+/// headers in unchanged SDK directories never touch the file system. New
+/// results are collected in memory and merged into the cache file with an
+/// atomic rename when the cache is destroyed.
+class PersistentStatCache : public FileSystemStatCache {
+  /// \brief The path of the shared cache file.
+  std::string CachePath;
+
+  /// \brief The mapped cache file, or null if it did not exist yet.
+  std::unique_ptr<llvm::MemoryBuffer> Buffer;
+
+  /// \brief The on-disk hash table in \c Buffer; its type is only visible
+  /// to the implementation.
+  void *Table;
+
+  /// \brief Whether each directory seen so far still has the modification
+  /// time recorded in the cache.
+  llvm::StringMap<bool, llvm::BumpPtrAllocator> ValidatedDirs;
+
+  /// \brief Results of stat() calls not found in the cache file, with the
+  /// modification time of their directory.
+  llvm::StringMap<std::pair<FileData, time_t>, llvm::BumpPtrAllocator>
+      NewEntries;
+
+  unsigned NumHits, NumMisses, NumStaleDirs;
+
+  explicit PersistentStatCache(StringRef CachePath);
+
+  /// \brief Check whether \p Dir still has the modification time \p ModTime.
+  bool isDirectoryUnchanged(StringRef Dir, time_t ModTime,
+                            vfs::FileSystem &FS);
+
+public:
+  ~PersistentStatCache();
+
+  /// \brief Open the cache file at \p CachePath, creating an empty cache if
+  /// the file does not exist or is unreadable.
+  static PersistentStatCache *open(StringRef CachePath);
+
+  /// \brief Merge the new entries into the cache file.
+  ///
+  /// \returns true on error.
+  bool flush();
+
+  LookupResult getStat(const char *Path, FileData &Data, bool isFile,
+                       vfs::File **F, vfs::FileSystem &FS) override;
+
+  unsigned getNumHits() const { return NumHits; }
+  unsigned getNumMisses() const { return NumMisses; }
+  unsigned getNumStaleDirs() const { return NumStaleDirs; }
+};
+
 } // end namespace clang
 
 #endif
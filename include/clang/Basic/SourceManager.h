@@ -642,6 +642,15 @@ class SourceManager : public RefCountedBase<SourceManager> {
   /// is very common to look up many tokens from the same file.
   mutable FileID LastFileIDLookup;
 
+  /// \brief A small most-recently-used cache consulted by getFileID after
+  /// LastFileIDLookup and before falling back to a binary search.
+  ///
+  /// Diagnostics and macro-heavy code bounce between a handful of files and
+  /// expansions, which defeats a one-entry cache.
+  enum { NumRecentFileIDLookups = 4 };
+  mutable FileID RecentFileIDLookups[NumRecentFileIDLookups];
+  mutable unsigned NextRecentFileIDLookup;
+
   /// \brief Holds information for \#line directives.
   ///
   /// This is referenced by indices from SLocEntryTable.
@@ -662,6 +671,11 @@ class SourceManager : public RefCountedBase<SourceManager> {
 
   // Statistics for -print-stats.
   mutable unsigned NumLinearScans, NumBinaryProbes;
+  mutable unsigned NumRecentFileIDHits;
+
+  /// \brief The number of macro expansions folded into the preceding
+  /// expansion entry rather than given an entry of their own.
+  unsigned NumMergedExpansions;
 
   /// \brief Associates a FileID with its "included/expanded in" decomposed
   /// location.
@@ -991,6 +1005,15 @@ public:
     if (isOffsetInFileID(LastFileIDLookup, SLocOffset))
       return LastFileIDLookup;
 
+    // Otherwise try the few entries looked up most recently.
+    for (unsigned I = 0; I != NumRecentFileIDLookups; ++I) {
+      FileID FID = RecentFileIDLookups[I];
+      if (!FID.isInvalid() && isOffsetInFileID(FID, SLocOffset)) {
+        ++NumRecentFileIDHits;
+        return LastFileIDLookup = FID;
+      }
+    }
+
     return getFileIDSlow(SLocOffset);
   }
 
@@ -1592,6 +1615,13 @@ private:
 
   /// Implements the common elements of storing an expansion info struct into
   /// the SLocEntry table and producing a source location that refers to it.
+  ///
+  /// A local expansion whose expansion range and kind match the previous
+  /// entry, and whose spelling continues exactly where that entry's spelling
+  /// ends, extends the previous entry instead of appending a new one. Offsets
+  /// within the merged entry still map linearly onto the spelling, so every
+  /// query answers as before while long runs of macro argument tokens
+  /// collapse into a single entry.
   SourceLocation createExpansionLocImpl(const SrcMgr::ExpansionInfo &Expansion,
                                         unsigned TokLength,
                                         int LoadedID = 0,
@@ -1645,6 +1675,14 @@ private:
 
   FileID getFileIDSlow(unsigned SLocOffset) const;
   FileID getFileIDLocal(unsigned SLocOffset) const;
+
+  /// \brief Record a FileID found by the slow path in the recent-lookup
+  /// cache, evicting the oldest entry.
+  void rememberFileIDLookup(FileID FID) const {
+    RecentFileIDLookups[NextRecentFileIDLookup] = FID;
+    NextRecentFileIDLookup =
+        (NextRecentFileIDLookup + 1) % NumRecentFileIDLookups;
+  }
   FileID getFileIDLoaded(unsigned SLocOffset) const;
 
   SourceLocation getExpansionLocSlowCase(SourceLocation Loc) const;
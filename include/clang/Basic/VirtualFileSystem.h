@@ -164,6 +164,32 @@ getVFSFromYAML(llvm::MemoryBuffer *Buffer,
                void *DiagContext = 0,
                IntrusiveRefCntPtr<FileSystem> ExternalFS = getRealFileSystem());
 
+/// \brief Gets a read-only \p FileSystem serving the contents of a packed SDK
+/// image, mounted at \p MountPoint.
+///
+/// An SDK image holds a directory tree and the contents of every file in it
+/// in a single file, as produced by writeSDKImage. The image is mapped once;
+/// \p status and \p openFileForRead for paths under \p MountPoint are
+/// answered from the mapping without touching the disk, and file buffers
+/// point directly into it. Paths outside the mount point, and paths under it
+/// that the image does not contain, are forwarded to \p ExternalFS.
+///
+/// Returns null and sets \p EC if the image cannot be mapped or is malformed.
+IntrusiveRefCntPtr<FileSystem>
+getVFSFromSDKImage(StringRef ImagePath, StringRef MountPoint,
+                   llvm::error_code &EC,
+                   IntrusiveRefCntPtr<FileSystem> ExternalFS =
+                       getRealFileSystem());
+
+/// \brief Pack the directory tree rooted at \p SDKRoot into an SDK image at
+/// \p OutputPath.
+///
+/// Only regular files and directories are recorded; symbolic links are
+/// resolved and stored as the files they point to. File contents are stored
+/// with their trailing null byte so that buffers handed out by the image can
+/// satisfy RequiresNullTerminator.
+llvm::error_code writeSDKImage(StringRef SDKRoot, StringRef OutputPath);
+
 } // end namespace vfs
 } // end namespace clang
 #endif // LLVM_CLANG_BASIC_VIRTUAL_FILE_SYSTEM_H
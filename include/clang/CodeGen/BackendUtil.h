@@ -35,6 +35,19 @@ namespace clang {
                          const TargetOptions &TOpts, const LangOptions &LOpts,
                          StringRef TDesc, llvm::Module *M, BackendAction Action,
                          raw_ostream *OS);
+
+  /// \brief Emit \p M as one native assembly or object file per element of
+  /// \p PartitionOS, running code generation for each on its own thread.
+  ///
+  /// The IR pipeline runs once over the whole module, as for a single
+  /// output; only code generation is partitioned (see llvm::splitCodeGen).
+  /// The outputs are ordinary objects that must all be linked together, so
+  /// the driver only uses this form when CodeGenOptions::BackendThreads is
+  /// above one and it can add the partitions to the link job.
+  void EmitBackendOutput(DiagnosticsEngine &Diags, const CodeGenOptions &CGOpts,
+                         const TargetOptions &TOpts, const LangOptions &LOpts,
+                         StringRef TDesc, llvm::Module *M, BackendAction Action,
+                         ArrayRef<raw_ostream *> PartitionOS);
 }
 
 #endif
@@ -24,6 +24,7 @@ namespace opt {
 
 namespace clang {
 namespace driver {
+  class DistributedExecutor;
   class Driver;
   class JobAction;
   class JobList;
@@ -69,6 +70,17 @@ class Compilation {
   /// Redirection for stdout, stderr, etc.
   const StringRef **Redirects;
 
+  /// The maximum number of commands to execute concurrently; 1 runs the job
+  /// list serially.
+  unsigned MaxParallelJobs;
+
+  /// The directory compilation results are cached in (-fcache-dir), or empty
+  /// if caching is disabled.
+  std::string CacheDir;
+
+  /// The executor for remote cc1 commands (-fdistribute), if any.
+  std::unique_ptr<DistributedExecutor> Remote;
+
 public:
   Compilation(const Driver &D, const ToolChain &DefaultToolChain,
               llvm::opt::InputArgList *Args,
@@ -93,6 +105,31 @@ public:
 
   void addCommand(Command *C) { Jobs.addJob(C); }
 
+  unsigned getMaxParallelJobs() const { return MaxParallelJobs; }
+  void setMaxParallelJobs(unsigned N) { MaxParallelJobs = N ? N : 1; }
+
+  /// setCacheDir - Cache the results of cc1 commands that produce an object
+  /// file in \p Dir.
+  ///
+  /// Before such a command is run, its key is computed: a hash of its
+  /// preprocessed output, or, in direct mode, of the main file and the
+  /// headers listed by a previous run's dependency file, together with its
+  /// arguments minus the output path and the clang version. If \p Dir holds
+  /// an entry for the key, the object and the saved diagnostics are copied
+  /// out and the command is not run. Otherwise the command runs and its
+  /// results are stored. Entries are written to a temporary name and
+  /// renamed, so \p Dir may be shared by concurrent builds, or over the
+  /// network.
+  void setCacheDir(StringRef Dir) { CacheDir = Dir; }
+  StringRef getCacheDir() const { return CacheDir; }
+
+  /// setDistributedExecutor - Run the commands \p E can distribute on its
+  /// workers, taking ownership of \p E. ExecuteJobs then keeps up to
+  /// E->getMaxParallelJobs() remote commands in flight, in addition to the
+  /// getMaxParallelJobs() local ones.
+  void setDistributedExecutor(DistributedExecutor *E);
+  DistributedExecutor *getDistributedExecutor() const { return Remote.get(); }
+
   const llvm::opt::ArgStringList &getTempFiles() const { return TempFiles; }
 
   const ArgStringMap &getResultFiles() const { return ResultFiles; }
@@ -155,7 +192,8 @@ public:
                       const JobAction *JA,
                       bool IssueErrors = false) const;
 
-  /// ExecuteCommand - Execute an actual command.
+  /// ExecuteCommand - Execute an actual command, or take its results from
+  /// the cache directory if it has one for it.
   ///
   /// \param FailingCommand - For non-zero results, this will be set to the
   /// Command which failed, if any.
@@ -169,6 +207,17 @@ public:
   void ExecuteJob(const Job &J,
      SmallVectorImpl< std::pair<int, const Command *> > &FailingCommands) const;
 
+  /// ExecuteJobs - Execute every command in \p Jobs, running up to
+  /// getMaxParallelJobs() commands at once. A command is only started once
+  /// all of its dependencies have succeeded; commands depending on a failed
+  /// command are not run.
+  ///
+  /// \param FailingCommands - For non-zero results, this will be a vector of
+  /// failing commands and their associated result code, in job list order
+  /// regardless of the order in which the commands completed.
+  void ExecuteJobs(const JobList &Jobs,
+     SmallVectorImpl< std::pair<int, const Command *> > &FailingCommands) const;
+
   /// initCompilationForDiagnostics - Remove stale state and suppress output
   /// so compilation can be reexecuted to generate additional diagnostic
   /// information (e.g., preprocessed source(s)).
@@ -0,0 +1,67 @@
+//===--- DistributedExecutor.h - Remote cc1 Execution -----------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef CLANG_DRIVER_DISTRIBUTEDEXECUTOR_H_
+#define CLANG_DRIVER_DISTRIBUTEDEXECUTOR_H_
+
+#include "clang/Basic/LLVM.h"
+#include "llvm/ADT/StringRef.h"
+#include <string>
+
+namespace clang {
+namespace driver {
+
+class Command;
+
+/// DistributedExecutor - Runs cc1 commands on remote workers.
+///
+/// The driver preprocesses each source locally, so workers need nothing but
+/// the same toolchain: the preprocessed file is compressed with
+/// llvm::zlib::compress and sent together with the cc1 arguments, and the
+/// object file and the diagnostics come back. Compilation::ExecuteJobs hands
+/// every command for which canDistribute returns true to execute, and runs
+/// the others, preprocessing and linking included, locally.
+class DistributedExecutor {
+public:
+  virtual ~DistributedExecutor();
+
+  /// canDistribute - Whether \p C can run remotely: a cc1 command that
+  /// compiles a preprocessed input to an object file.
+  virtual bool canDistribute(const Command &C) const = 0;
+
+  /// execute - Run \p C, whose input is the preprocessed file
+  /// \p PreprocessedPath, on a worker, and write the object it produces to
+  /// \p OutputPath. The diagnostics printed on the worker are returned in
+  /// \p Diagnostics.
+  ///
+  /// A worker that cannot be reached or fails for a reason other than the
+  /// compilation itself is retried on another one, up to the retry limit,
+  /// after which the command is run locally.
+  ///
+  /// \return The result code of the compilation.
+  virtual int execute(const Command &C, StringRef PreprocessedPath,
+                      StringRef OutputPath, std::string &Diagnostics) = 0;
+
+  /// getMaxParallelJobs - How many commands may be running remotely at
+  /// once, usually the total number of slots on the workers.
+  virtual unsigned getMaxParallelJobs() const = 0;
+};
+
+/// createDistributedExecutor - Create an executor for the workers in
+/// \p Workers, a comma separated list of host:port[/slots] entries, as given
+/// to -fdistribute=. Returns null, with the reason in \p Error, if the list
+/// is malformed or no worker can be reached.
+DistributedExecutor *createDistributedExecutor(StringRef Workers,
+                                               unsigned MaxRetries,
+                                               std::string &Error);
+
+} // end namespace driver
+} // end namespace clang
+
+#endif
@@ -153,6 +153,13 @@ public:
   /// Whether the driver is generating diagnostics for debugging purposes.
   unsigned CCGenDiagnostics : 1;
 
+  /// The number of independent jobs to run concurrently, as given by -j<N>.
+  unsigned NumParallelJobs;
+
+  /// If set, -cc1 jobs are run inside the driver process through this entry
+  /// point instead of re-executing the driver (see -fintegrated-cc1).
+  CC1EntryPoint CC1Main;
+
 private:
   /// Name to use when invoking gcc/g++.
   std::string CCCGenericGCCName;
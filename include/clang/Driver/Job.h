@@ -11,6 +11,8 @@
 #define CLANG_DRIVER_JOB_H_
 
 #include "clang/Basic/LLVM.h"
+#include "clang/Driver/Util.h"
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/Option/Option.h"
 #include <memory>
@@ -33,6 +35,7 @@ public:
   enum JobClass {
     CommandClass,
     FallbackCommandClass,
+    InProcessCC1CommandClass,
     JobListClass
   };
 
@@ -72,6 +75,10 @@ class Command : public Job {
   /// argument, which will be the executable).
   llvm::opt::ArgStringList Arguments;
 
+  /// The commands whose outputs this command consumes, and which must
+  /// therefore complete successfully before it can be started.
+  SmallVector<const Command *, 2> Dependencies;
+
 public:
   Command(const Action &_Source, const Tool &_Creator, const char *_Executable,
           const llvm::opt::ArgStringList &_Arguments);
@@ -92,9 +99,17 @@ public:
 
   const llvm::opt::ArgStringList &getArguments() const { return Arguments; }
 
+  /// addDependency - Record that this command reads the output of \p C.
+  void addDependency(const Command *C) { Dependencies.push_back(C); }
+
+  /// getDependencies - Return the commands which must finish before this
+  /// command may be executed.
+  ArrayRef<const Command *> getDependencies() const { return Dependencies; }
+
   static bool classof(const Job *J) {
     return J->getKind() == CommandClass ||
-           J->getKind() == FallbackCommandClass;
+           J->getKind() == FallbackCommandClass ||
+           J->getKind() == InProcessCC1CommandClass;
   }
 };
 
@@ -120,6 +135,27 @@ private:
   std::unique_ptr<Command> Fallback;
 };
 
+/// Like Command, but runs a -cc1 invocation inside the driver process rather
+/// than spawning a new one. The invocation is executed under a
+/// CrashRecoveryContext; if it crashes, the command is re-executed as a
+/// separate process so the usual crash diagnostics are produced.
+class InProcessCC1Command : public Command {
+public:
+  InProcessCC1Command(const Action &Source_, const Tool &Creator_,
+                      const char *Executable_, const ArgStringList &Arguments_,
+                      CC1EntryPoint Entry_);
+
+  int Execute(const StringRef **Redirects, std::string *ErrMsg,
+              bool *ExecutionFailed) const override;
+
+  static bool classof(const Job *J) {
+    return J->getKind() == InProcessCC1CommandClass;
+  }
+
+private:
+  CC1EntryPoint Entry;
+};
+
 /// JobList - A sequence of jobs to perform.
 class JobList : public Job {
 public:
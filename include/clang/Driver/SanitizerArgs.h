@@ -60,6 +60,16 @@ class SanitizerArgs {
 
   bool needsAsanRt() const { return Kind & NeedsAsanRt; }
   bool needsSharedAsanRt() const { return AsanSharedRuntime; }
+
+  /// Return the file name of the ASan runtime linked for \p TC, which is
+  /// looked up in the darwin directory of the resource dir for Darwin
+  /// targets: libclang_rt.asan_osx_dynamic.dylib for OS X and
+  /// libclang_rt.asan_ios_dynamic.dylib for iOS, including armv7 devices.
+  /// The iOS runtime is a dylib that is copied into the application bundle
+  /// and found through @rpath. Returns an empty string if there is no runtime
+  /// for the target, in which case -fsanitize=address is diagnosed as
+  /// unsupported.
+  static std::string getAsanRuntimeName(const ToolChain &TC);
   bool needsTsanRt() const { return Kind & NeedsTsanRt; }
   bool needsMsanRt() const { return Kind & NeedsMsanRt; }
   bool needsLeakDetection() const { return Kind & NeedsLeakDetection; }
@@ -75,6 +75,22 @@ public:
                             const InputInfoList &Inputs,
                             const llvm::opt::ArgList &TCArgs,
                             const char *LinkingOutput) const = 0;
+
+  /// \brief Can one invocation of this tool perform several jobs of the same
+  /// kind, each with its own inputs and output? The driver then hands all of
+  /// them to ConstructBatchJob instead of making one process per job, so
+  /// process startup does not dominate builds of many small files.
+  virtual bool canBatchJobs() const { return false; }
+
+  /// ConstructBatchJob - Construct a single job that performs every action
+  /// in \p JAs, where JAs[i] reads Inputs[i] and writes Outputs[i]. Only
+  /// called if canBatchJobs() returns true, with actions that share
+  /// \p TCArgs. The default constructs one job per action.
+  virtual void ConstructBatchJob(Compilation &C,
+                                 ArrayRef<const JobAction *> JAs,
+                                 ArrayRef<InputInfo> Outputs,
+                                 ArrayRef<InputInfoList> Inputs,
+                                 const llvm::opt::ArgList &TCArgs) const;
 };
 
 } // end namespace driver
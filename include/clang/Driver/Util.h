@@ -26,6 +26,11 @@ namespace driver {
   /// ActionList - Type used for lists of actions.
   typedef SmallVector<Action*, 3> ActionList;
 
+  /// CC1EntryPoint - The signature of the cc1 entry point linked into the
+  /// driver, used to run -cc1 jobs in-process (see -fintegrated-cc1).
+  typedef int (*CC1EntryPoint)(ArrayRef<const char *> Argv, const char *Argv0,
+                               void *MainAddr);
+
 } // end namespace driver
 } // end namespace clang
 
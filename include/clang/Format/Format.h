@@ -17,6 +17,8 @@
 
 #include "clang/Frontend/FrontendAction.h"
 #include "clang/Tooling/Refactoring.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/Support/Mutex.h"
 #include "llvm/Support/system_error.h"
 
 namespace clang {
@@ -76,6 +78,15 @@ struct FormatStyle {
   /// \brief The penalty for breaking a function call after "call(".
   unsigned PenaltyBreakBeforeFirstCallParameter;
 
+  /// \brief The maximum number of line states the line breaking search
+  /// explores for one unwrapped line.
+  ///
+  /// States that agree on everything later decisions can depend on are
+  /// explored only once. When the budget is exhausted, e.g. on long
+  /// Objective-C message sends or nested block literals in generated code,
+  /// the rest of the line is laid out greedily. \c 0 means no limit.
+  unsigned MaxLineBreakingStates;
+
   /// \brief Set whether & and * bind to the type as opposed to the variable.
   bool PointerBindsToType;
 
@@ -362,6 +373,7 @@ struct FormatStyle {
                R.IndentFunctionDeclarationAfterType &&
            IndentWidth == R.IndentWidth && Language == R.Language &&
            MaxEmptyLinesToKeep == R.MaxEmptyLinesToKeep &&
+           MaxLineBreakingStates == R.MaxLineBreakingStates &&
            KeepEmptyLinesAtTheStartOfBlocks ==
                R.KeepEmptyLinesAtTheStartOfBlocks &&
            NamespaceIndentation == R.NamespaceIndentation &&
@@ -443,6 +455,12 @@ std::string configurationAsText(const FormatStyle &Style);
 /// everything that might influence its formatting or might be influenced by its
 /// formatting.
 ///
+/// Only the top-level declarations that enclose a range are parsed into
+/// unwrapped lines and annotated; the rest of the token stream is merely
+/// scanned for brace depth to find their boundaries. Formatting a few lines
+/// of a large file thus costs about as much as formatting the declarations
+/// they are in.
+///
 /// Returns the \c Replacements necessary to make all \p Ranges comply with
 /// \p Style.
 tooling::Replacements reformat(const FormatStyle &Style, Lexer &Lex,
@@ -456,6 +474,38 @@ tooling::Replacements reformat(const FormatStyle &Style, StringRef Code,
                                std::vector<tooling::Range> Ranges,
                                StringRef FileName = "<stdin>");
 
+/// \brief Reformats successive versions of files for a long-lived client, such
+/// as an editor's format-on-save hook or a formatting server.
+///
+/// For each file it keeps the top-level declaration boundaries and the
+/// annotated lines of the last version it saw. A later reformat() only
+/// relexes from the first byte that changed, and reuses the layout of lines
+/// whose tokens and starting column are unchanged.
+class IncrementalFormatter {
+public:
+  explicit IncrementalFormatter(const FormatStyle &Style);
+  ~IncrementalFormatter();
+
+  /// \brief Reformats \p Ranges of \p Code, the current contents of
+  /// \p FileName, like the reformat() function above.
+  tooling::Replacements reformat(StringRef Code,
+                                 ArrayRef<tooling::Range> Ranges,
+                                 StringRef FileName);
+
+  /// \brief Drops what is cached for \p FileName, e.g. when it is closed.
+  void forgetFile(StringRef FileName);
+
+  const FormatStyle &getStyle() const { return Style; }
+
+private:
+  IncrementalFormatter(const IncrementalFormatter &) LLVM_DELETED_FUNCTION;
+  void operator=(const IncrementalFormatter &) LLVM_DELETED_FUNCTION;
+
+  struct FileCache;
+  FormatStyle Style;
+  llvm::StringMap<FileCache *> Files;
+};
+
 /// \brief Returns the \c LangOpts that the formatter expects you to set.
 ///
 /// \param Standard determines lexing mode: LC_Cpp11 and LS_Auto turn on C++11
@@ -490,6 +540,29 @@ extern const char *StyleOptionHelpDescription;
 FormatStyle getStyle(StringRef StyleName, StringRef FileName,
                      StringRef FallbackStyle);
 
+/// \brief Resolves styles like getStyle() for many files, such as the
+/// inputs of a parallel clang-format run, looking each directory up once.
+///
+/// The style found for a directory and language is cached, so files in the
+/// same directory share one search of the parent directories and one parse
+/// of the .clang-format file. getStyle() may be called from several threads
+/// at once.
+class FormatStyleCache {
+public:
+  FormatStyleCache(StringRef StyleName, StringRef FallbackStyle)
+    : StyleName(StyleName), FallbackStyle(FallbackStyle) {}
+
+  /// \brief Equivalent to getStyle(StyleName, FileName, FallbackStyle).
+  FormatStyle getStyle(StringRef FileName);
+
+private:
+  std::string StyleName;
+  std::string FallbackStyle;
+  llvm::sys::Mutex Lock;
+  /// Keyed by directory and language.
+  llvm::StringMap<FormatStyle> Styles;
+};
+
 } // end namespace format
 } // end namespace clang
 
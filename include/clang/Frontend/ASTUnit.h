@@ -60,6 +60,7 @@ class SourceManager;
 class TargetInfo;
 class ASTFrontendAction;
 class ASTDeserializationListener;
+class PreambleCache;
 
 /// \brief Utility class for loading a ASTContext from an AST file.
 ///
@@ -301,6 +302,10 @@ private:
   /// \brief True if non-system source files should be treated as volatile
   /// (likely to change while trying to use them).
   bool UserFilesAreVolatile : 1;
+
+  /// \brief The cache consulted before building a precompiled preamble, and
+  /// into which newly built preambles are published. Not owned.
+  PreambleCache *SharedPreambles;
  
   /// \brief The language options used when we load an AST file.
   LangOptions ASTFileLangOpts;
@@ -383,6 +388,17 @@ private:
 
   /// \brief The set of cached code-completion results.
   std::vector<CachedCodeCompletionResult> CachedCompletionResults;
+
+  /// \brief Indices into CachedCompletionResults, sorted case-insensitively
+  /// by typed text, so the results starting with a prefix are found by
+  /// binary search instead of a scan of every cached result.
+  std::vector<unsigned> CachedCompletionsByName;
+
+  /// \brief The filter of the last getCachedCompletionsMatching() call and
+  /// the results it matched. A filter that extends it, as when the user
+  /// types one more character, only needs to rescan those.
+  std::string LastCompletionFilter;
+  std::vector<unsigned> LastCompletionMatches;
   
   /// \brief A mapping from the formatted type name to a unique number for that
   /// type, which is used for type equality comparisons.
@@ -524,6 +540,12 @@ public:
   bool getOwnsRemappedFileBuffers() const { return OwnsRemappedFileBuffers; }
   void setOwnsRemappedFileBuffers(bool val) { OwnsRemappedFileBuffers = val; }
 
+  /// \brief Share precompiled preambles with other units through \p Cache.
+  ///
+  /// The cache must outlive this ASTUnit.
+  void setPreambleCache(PreambleCache *Cache) { SharedPreambles = Cache; }
+  PreambleCache *getPreambleCache() const { return SharedPreambles; }
+
   StringRef getMainFileName() const;
 
   /// \brief If this ASTUnit came from an AST file, returns the filename for it.
@@ -652,6 +674,18 @@ public:
     return CachedCompletionResults.end();
   }
 
+  /// \brief Find the cached completion results that are shown in any of
+  /// \p Contexts (a CodeCompletionContext::Kind bitmask, as in
+  /// CachedCodeCompletionResult::ShowInContexts) and fuzzy match \p Filter.
+  ///
+  /// \param Matches Receives the indices of the matching results, best
+  /// first by getFuzzyMatchScore() and then priority.
+  ///
+  /// \param MaxResults If nonzero, at most this many results are returned.
+  void getCachedCompletionsMatching(StringRef Filter, uint64_t Contexts,
+                                    unsigned MaxResults,
+                                    SmallVectorImpl<unsigned> &Matches);
+
   unsigned cached_completion_size() const { 
     return CachedCompletionResults.size(); 
   }
@@ -809,7 +843,8 @@ public:
       bool IncludeBriefCommentsInCodeCompletion = false,
       bool AllowPCHWithCompilerErrors = false, bool SkipFunctionBodies = false,
       bool UserFilesAreVolatile = false, bool ForSerialization = false,
-      std::unique_ptr<ASTUnit> *ErrAST = 0);
+      std::unique_ptr<ASTUnit> *ErrAST = 0,
+      bool KeepMainFileFunctionBodies = false);
 
   /// \brief Reparse the source files using the same command-line options that
   /// were originally used to produce this translation unit.
@@ -143,7 +143,10 @@ public:
   /// Name of the profile file to use with -fprofile-sample-use.
   std::string SampleProfileFile;
 
-  /// Name of the profile file to use as input for -fprofile-instr-use
+  /// Name of the profile file to use as input for -fprofile-instr-use.
+  /// Its counts become branch weights for block placement, and functions the
+  /// profile never entered are marked cold and emitted to the cold text
+  /// section (see llvm::TargetOptions::ColdFunctionSection).
   std::string InstrProfileInput;
 
   /// Regular expression to select optimizations for which we should enable
@@ -0,0 +1,85 @@
+//===--- CompileServer.h - Persistent cc1 Compile Server --------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+//  This file defines the CompileServer class, which services -cc1 compile
+//  requests from a named pipe while keeping file system and module state warm
+//  between translation units.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_FRONTEND_COMPILESERVER_H
+#define LLVM_CLANG_FRONTEND_COMPILESERVER_H
+
+#include "clang/Basic/FileManager.h"
+#include "clang/Basic/FileSystemOptions.h"
+#include "clang/Basic/LLVM.h"
+#include "llvm/ADT/IntrusiveRefCntPtr.h"
+#include "llvm/ADT/StringRef.h"
+#include <string>
+
+namespace clang {
+class ASTReader;
+class DiagnosticConsumer;
+
+/// \brief A long-lived server which runs -cc1 invocations in-process.
+///
+/// Each request carries a full -cc1 argument vector and a working directory.
+/// The server builds a fresh CompilerInvocation and CompilerInstance for
+/// every request, but shares a single FileManager (and its stat cache) and
+/// the module manager between them. Before each request, cached files whose
+/// size or modification time changed on disk are invalidated, so results
+/// match those of a cold compile.
+class CompileServer {
+  /// \brief The pipe on which requests are received.
+  std::string PipeName;
+
+  /// \brief The file manager shared by all requests.
+  IntrusiveRefCntPtr<FileManager> FileMgr;
+
+  /// \brief The module manager of the most recent compilation, if it can be
+  /// reused by the next one.
+  IntrusiveRefCntPtr<ASTReader> ModuleManager;
+
+  /// \brief Number of requests serviced so far.
+  unsigned NumRequests;
+
+  /// \brief Number of cached file entries invalidated between requests.
+  unsigned NumInvalidatedFiles;
+
+public:
+  explicit CompileServer(StringRef PipeName);
+  ~CompileServer();
+
+  /// \brief Run a single -cc1 invocation using the warm server state.
+  ///
+  /// \param Args the -cc1 arguments, not including the program name.
+  /// \param WorkingDir the directory relative paths are resolved against.
+  /// \param Diags where diagnostics for this request are reported.
+  ///
+  /// \returns the exit code the equivalent cc1 process would have returned.
+  int compile(ArrayRef<const char *> Args, StringRef WorkingDir,
+              DiagnosticConsumer &Diags);
+
+  /// \brief Accept and service requests on the pipe until a shutdown request
+  /// is received or the pipe is closed.
+  ///
+  /// \returns true if the server shut down cleanly.
+  bool serve(std::string &ErrorMsg);
+
+  /// \brief Drop all cached state, forcing the next request to start cold.
+  void reset();
+
+  StringRef getPipeName() const { return PipeName; }
+  unsigned getNumRequests() const { return NumRequests; }
+  unsigned getNumInvalidatedFiles() const { return NumInvalidatedFiles; }
+};
+
+} // end namespace clang
+
+#endif
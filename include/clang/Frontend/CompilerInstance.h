@@ -34,6 +34,7 @@ namespace clang {
 class ASTContext;
 class ASTConsumer;
 class ASTReader;
+class CFGCache;
 class CodeCompleteConsumer;
 class DiagnosticsEngine;
 class DiagnosticConsumer;
@@ -99,6 +100,10 @@ class CompilerInstance : public ModuleLoader {
   /// \brief The semantic analysis object.
   std::unique_ptr<Sema> TheSema;
 
+  /// \brief CFGs shared by analysis-based warnings and the static analyzer,
+  /// if the analyzer is running.
+  std::unique_ptr<CFGCache> SharedCFGs;
+
   /// \brief The frontend timer
   std::unique_ptr<llvm::Timer> FrontendTimer;
 
@@ -453,6 +458,18 @@ public:
 
   Sema *takeSema() { return TheSema.release(); }
 
+  /// \brief Create the CFG cache shared by Sema's analysis-based warnings
+  /// and the static analyzer.
+  ///
+  /// Only ento::AnalysisAction calls this, before createSema(). A cached
+  /// CFG lives until the end of the translation unit, so a compile without
+  /// --analyze has no cache, and each function's CFG is freed as soon as
+  /// its warnings have been issued.
+  CFGCache &createSharedCFGCache();
+
+  /// \brief Return the shared CFG cache, or null if none was created.
+  CFGCache *getSharedCFGCache() const { return SharedCFGs.get(); }
+
   /// }
   /// @name Module Management
   /// {
@@ -595,7 +612,9 @@ public:
                                const CodeCompleteOptions &Opts,
                                raw_ostream &OS);
 
-  /// \brief Create the Sema object to be used for parsing.
+  /// \brief Create the Sema object to be used for parsing. Its
+  /// analysis-based warnings build their CFGs through the shared CFG cache,
+  /// if one was created.
   void createSema(TranslationUnitKind TUKind,
                   CodeCompleteConsumer *CompletionConsumer);
   
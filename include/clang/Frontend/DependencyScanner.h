@@ -0,0 +1,143 @@
+//===--- DependencyScanner.h - Parallel dependency scanning -----*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+//  This file defines the DependencyScanner class, which discovers the header
+//  dependencies of many translation units in one process without running the
+//  full preprocessor over their sources.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_FRONTEND_DEPENDENCYSCANNER_H
+#define LLVM_CLANG_FRONTEND_DEPENDENCYSCANNER_H
+
+#include "clang/Basic/LLVM.h"
+#include "clang/Frontend/CompilerInvocation.h"
+#include "clang/Frontend/DependencyOutputOptions.h"
+#include "llvm/ADT/IntrusiveRefCntPtr.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/Support/Allocator.h"
+#include "llvm/Support/Mutex.h"
+#include <string>
+#include <vector>
+
+namespace llvm {
+class MemoryBuffer;
+class raw_ostream;
+}
+
+namespace clang {
+
+class DiagnosticConsumer;
+class IncludeGuardCatalog;
+class PersistentStatCache;
+
+/// \brief Reduce \p Input to the preprocessor directives it contains.
+///
+/// Every line that does not start a directive is dropped; comments are
+/// removed and escaped newlines inside directives are joined. Only
+/// \#define, \#undef, \#include, \#include_next, \#import, the conditional
+/// directives and \#pragma once survive, which is everything that can affect
+/// the set of files a translation unit includes.
+///
+/// \returns true if the input could not be minimized (for instance because it
+/// uses trigraphs), in which case the caller should preprocess it normally.
+bool minimizeSourceToDirectives(StringRef Input,
+                                SmallVectorImpl<char> &Output);
+
+/// \brief Scans a list of translation units for their dependencies.
+///
+/// Each input is preprocessed with the options of a base invocation, but
+/// sources and headers are first minimized with minimizeSourceToDirectives so
+/// that the preprocessor only ever sees directives. Minimized headers are
+/// shared between inputs, as are the stat cache and include guard catalog, so
+/// a header common to many inputs is read and minimized once.
+///
+/// Inputs are distributed over a pool of threads. Output for each input is
+/// collected separately and written in input order, in the same format
+/// DependencyFileGenerator produces for -M and -MM.
+class DependencyScanner {
+  IntrusiveRefCntPtr<CompilerInvocation> BaseInvocation;
+  unsigned NumThreads;
+
+  /// \brief Minimized file contents, keyed by the real path of the file.
+  llvm::StringMap<llvm::MemoryBuffer *, llvm::BumpPtrAllocator> Minimized;
+  llvm::sys::Mutex MinimizedLock;
+
+  IncludeGuardCatalog *GuardCatalog;
+  PersistentStatCache *StatCache;
+
+  unsigned NumFilesMinimized, NumMinimizedCacheHits;
+
+  DependencyScanner(const DependencyScanner &) LLVM_DELETED_FUNCTION;
+  void operator=(const DependencyScanner &) LLVM_DELETED_FUNCTION;
+
+public:
+  /// \brief Create a scanner that runs \p Invocation, with its inputs
+  /// replaced, once per input file.
+  ///
+  /// \param NumThreads The number of worker threads; 0 selects one per
+  /// hardware thread.
+  DependencyScanner(CompilerInvocation *Invocation, unsigned NumThreads = 0);
+  ~DependencyScanner();
+
+  /// \brief Share \p Catalog among all scans. Not owned.
+  void setIncludeGuardCatalog(IncludeGuardCatalog *Catalog) {
+    GuardCatalog = Catalog;
+  }
+
+  /// \brief Share \p Cache among all scans. Not owned.
+  void setStatCache(PersistentStatCache *Cache) { StatCache = Cache; }
+
+  /// \brief Return the minimized contents of \p Path, minimizing and caching
+  /// them on first use, or null if the file should be read unchanged.
+  const llvm::MemoryBuffer *getMinimizedFile(StringRef Path);
+
+  /// \brief Scan every file in \p Inputs and write the dependency rules for
+  /// each to \p OS, honoring \p Opts.
+  ///
+  /// \returns true if any input failed to scan.
+  bool scan(ArrayRef<std::string> Inputs, const DependencyOutputOptions &Opts,
+            raw_ostream &OS, DiagnosticConsumer &Diags);
+
+  /// \brief A module some input imports, directly or not, as found by
+  /// scanModuleGraph.
+  struct ModuleDep {
+    /// \brief The full name of the top-level module.
+    std::string Name;
+    /// \brief The module map file that defines it.
+    std::string ModuleMapFile;
+    /// \brief The path of the .pcm to build for it, under the module cache
+    /// path of the base invocation.
+    std::string ModuleFile;
+    /// \brief Indices into the module list of the modules it imports.
+    std::vector<unsigned> Imports;
+  };
+
+  /// \brief Scan every file in \p Inputs for the modules it imports, and
+  /// build the module dependency graph of the whole set.
+  ///
+  /// \p Modules receives each module once, in an order where a module comes
+  /// after everything it imports, so a build system can build the .pcm files
+  /// wave by wave in parallel with -emit-module. \p InputModules receives,
+  /// for each input, the indices of the modules it needs, to be passed as
+  /// -fmodule-file options when it is compiled. A compile given every module
+  /// it needs this way never builds or revalidates a module implicitly.
+  ///
+  /// \returns true if any input failed to scan.
+  bool scanModuleGraph(ArrayRef<std::string> Inputs,
+                       std::vector<ModuleDep> &Modules,
+                       std::vector<std::vector<unsigned> > &InputModules,
+                       DiagnosticConsumer &Diags);
+
+  void PrintStats() const;
+};
+
+} // end namespace clang
+
+#endif
@@ -237,6 +237,15 @@ protected:
 
   bool hasPCHSupport() const override { return true; }
 };
+
+/// \brief Preprocess minimized, directive-only versions of the input and its
+/// headers, producing only the dependency output (-scan-deps).
+class ScanDependenciesAction : public PreprocessorFrontendAction {
+protected:
+  bool BeginSourceFileAction(CompilerInstance &CI,
+                             StringRef Filename) override;
+  void ExecuteAction() override;
+};
   
 }  // end namespace clang
 
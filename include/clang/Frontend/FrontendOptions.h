@@ -53,6 +53,7 @@ namespace frontend {
     RewriteObjC,            ///< ObjC->C Rewriter.
     RewriteTest,            ///< Rewriter playground
     RunAnalysis,            ///< Run one or more source code analyses.
+    ScanDependencies,       ///< Emit dependencies from minimized sources.
     MigrateSource,          ///< Run migrator.
     RunPreprocessorOnly     ///< Just lex, no output.
   };
@@ -124,8 +125,14 @@ public:
   unsigned ShowHelp : 1;                   ///< Show the -help text.
   unsigned ShowStats : 1;                  ///< Show frontend performance
                                            /// metrics and statistics.
+  unsigned ShowASTMemoryStats : 1;         ///< Show AST memory use per node
+                                           /// class and per slab.
+  unsigned ShowDeserializationStats : 1;   ///< Show which AST file entities
+                                           /// were deserialized, and why.
   unsigned ShowTimers : 1;                 ///< Show timers for individual
                                            /// actions.
+  unsigned TimeTrace : 1;                  ///< Write a Chrome trace of the
+                                           /// compilation next to the output.
   unsigned ShowVersion : 1;                ///< Show the -version text.
   unsigned FixWhatYouCan : 1;              ///< Apply fixes even if there are
                                            /// unfixable errors.
@@ -138,6 +145,14 @@ public:
                                            /// speed up parsing in cases you do
                                            /// not need them (e.g. with code
                                            /// completion).
+  unsigned KeepMainFileFunctionBodies : 1; ///< When skipping function
+                                           /// bodies, still parse those in
+                                           /// the main file.
+  unsigned DeferObjCMethodBodies : 1;      ///< Parse Objective-C method
+                                           /// bodies at the end of the
+                                           /// translation unit, where they
+                                           /// see later declarations and
+                                           /// the final pragma state.
   unsigned UseGlobalModuleIndex : 1;       ///< Whether we can use the
                                            ///< global module index if available.
   unsigned GenerateGlobalModuleIndex : 1;  ///< Whether we can generate the
@@ -201,6 +216,10 @@ public:
   /// The output file, if any.
   std::string OutputFile;
 
+  /// If given, the index store directory to which the symbol occurrences of
+  /// the translation unit are recorded while it is compiled.
+  std::string IndexStorePath;
+
   /// If given, the new suffix for fix-it rewritten files.
   std::string FixItSuffix;
 
@@ -231,6 +250,11 @@ public:
   /// \brief The list of AST files to merge.
   std::vector<std::string> ASTMergeFiles;
 
+  /// \brief The list of prebuilt module files to load before processing the
+  /// input (-fmodule-file). Imports of the modules they contain are
+  /// satisfied from them instead of from the module cache.
+  std::vector<std::string> ModuleFiles;
+
   /// \brief A list of arguments to forward to LLVM's option processing; this
   /// should only be used for debugging and experimental features.
   std::vector<std::string> LLVMArgs;
@@ -238,17 +262,33 @@ public:
   /// \brief File name of the file that will provide record layouts
   /// (in the format produced by -fdump-record-layouts).
   std::string OverrideRecordLayoutsFile;
+
+  /// The log2 of the factor by which to scale the AST allocator's slabs.
+  unsigned ASTSlabSizeShift;
+
+  /// The number of threads used to encode records when writing an AST file.
+  unsigned ASTWriterThreads;
+
+  /// The number of threads used for the deferred thread safety and consumed
+  /// analyses; 0 runs them immediately after each function body. Deferring
+  /// moves their diagnostics to the end of the translation unit.
+  unsigned AnalysisWarningsThreads;
   
 public:
   FrontendOptions() :
     DisableFree(false), RelocatablePCH(false), ShowHelp(false),
-    ShowStats(false), ShowTimers(false), ShowVersion(false),
-    FixWhatYouCan(false), FixOnlyWarnings(false), FixAndRecompile(false),
+    ShowStats(false), ShowASTMemoryStats(false),
+    ShowDeserializationStats(false), ShowTimers(false), TimeTrace(false),
+    ShowVersion(false), FixWhatYouCan(false), FixOnlyWarnings(false),
+    FixAndRecompile(false),
     FixToTemporaries(false), ARCMTMigrateEmitARCErrors(false),
-    SkipFunctionBodies(false), UseGlobalModuleIndex(true),
+    SkipFunctionBodies(false), KeepMainFileFunctionBodies(false),
+    DeferObjCMethodBodies(false),
+    UseGlobalModuleIndex(true),
     GenerateGlobalModuleIndex(true), ASTDumpLookups(false),
     ARCMTAction(ARCMT_None), ObjCMTAction(ObjCMT_None),
-    ProgramAction(frontend::ParseSyntaxOnly)
+    ProgramAction(frontend::ParseSyntaxOnly), ASTSlabSizeShift(0),
+    ASTWriterThreads(1), AnalysisWarningsThreads(0)
   {}
 
   /// getInputKindForExtension - Return the appropriate input kind for a file
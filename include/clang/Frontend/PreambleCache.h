@@ -0,0 +1,93 @@
+//===--- PreambleCache.h - Shared Precompiled Preamble Cache ----*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+//  This file defines PreambleCache, a content-addressed on-disk store of
+//  precompiled preambles that can be shared between ASTUnits and processes.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_FRONTEND_PREAMBLECACHE_H
+#define LLVM_CLANG_FRONTEND_PREAMBLECACHE_H
+
+#include "clang/Frontend/ASTUnit.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/MD5.h"
+#include <string>
+
+namespace llvm {
+  class MemoryBuffer;
+}
+
+namespace clang {
+class CompilerInvocation;
+
+/// \brief A directory of precompiled preambles, keyed by their contents.
+///
+/// The key of a preamble is the MD5 of the preamble bytes, of the name and
+/// \c ASTUnit::PreambleFileHash of every file it depends on, and of the
+/// parts of the compiler invocation which affect the generated PCH. Entries
+/// are written to a uniquely named temporary file and renamed into place, so
+/// concurrent processes never observe a partially written preamble.
+class PreambleCache {
+public:
+  typedef llvm::StringMap<ASTUnit::PreambleFileHash> FileHashMap;
+
+  /// \brief The content-derived key of a cached preamble.
+  struct Key {
+    llvm::MD5::MD5Result Hash;
+
+    /// \brief Render the key as a 32 character hexadecimal string.
+    void getDigest(SmallVectorImpl<char> &Digest) const;
+  };
+
+private:
+  /// \brief The directory in which cached preambles are stored.
+  std::string CachePath;
+
+  unsigned NumHits, NumMisses;
+
+public:
+  explicit PreambleCache(StringRef CachePath)
+    : CachePath(CachePath), NumHits(0), NumMisses(0) { }
+
+  /// \brief Compute the cache key for a preamble.
+  static Key computeKey(const llvm::MemoryBuffer *PreambleBuffer,
+                        const FileHashMap &FilesInPreamble,
+                        const CompilerInvocation &Invocation);
+
+  /// \brief Look up a cached preamble.
+  ///
+  /// On a hit, \p PCHPath is set to the cached PCH file and \p Files to the
+  /// files that preamble was built from. The caller must still verify that
+  /// those files are unchanged before using the preamble.
+  ///
+  /// \returns true if a matching preamble was found.
+  bool lookup(const Key &K, std::string &PCHPath, FileHashMap &Files);
+
+  /// \brief Publish the preamble built at \p TempPCHPath under \p K.
+  ///
+  /// The file is moved into the cache directory; if another process already
+  /// published the same key, the existing entry is kept.
+  ///
+  /// \returns true on success.
+  bool publish(const Key &K, StringRef TempPCHPath, const FileHashMap &Files);
+
+  /// \brief Remove entries that have not been used for \p MaxAgeSeconds.
+  void prune(unsigned MaxAgeSeconds);
+
+  StringRef getCachePath() const { return CachePath; }
+  unsigned getNumHits() const { return NumHits; }
+  unsigned getNumMisses() const { return NumMisses; }
+};
+
+} // end namespace clang
+
+#endif
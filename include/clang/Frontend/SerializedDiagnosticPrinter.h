@@ -11,7 +11,9 @@
 #define LLVM_CLANG_FRONTEND_SERIALIZE_DIAGNOSTIC_PRINTER_H_
 
 #include "clang/Basic/LLVM.h"
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/Bitcode/BitstreamWriter.h"
+#include <string>
 
 namespace llvm {
 class raw_ostream;
@@ -67,8 +69,29 @@ enum Level {
 /// This allows wrapper tools for Clang to get diagnostics from Clang
 /// (via libclang) without needing to parse Clang's command line output.
 ///
+/// If \p Compact is true, the output is written through a large buffer and
+/// is smaller: fix-it replacement strings and diagnostic flag names are
+/// emitted once, the first time they are used, and referred to by ID after
+/// that, the way file names and categories already are.
 DiagnosticConsumer *create(raw_ostream *OS,
-                           DiagnosticOptions *diags);
+                           DiagnosticOptions *diags,
+                           bool Compact = false);
+
+/// \brief Merge the serialized diagnostics files \p Inputs, typically one per
+/// translation unit of a build, into a single database at \p OutputPath.
+///
+/// File, category and flag records are shared by all inputs, so a header
+/// that produces the same warning in every translation unit costs one record
+/// for its file. The database keeps an on-disk hash table from file name to
+/// the diagnostics located in that file, and another from diagnostic flag to
+/// diagnostics, so an IDE can answer "what is wrong with this file" without
+/// reading every input. Diagnostics that are identical in every respect are
+/// stored once, with the list of translation units that produced them.
+///
+/// \returns true, with a message in \p Error, if an input cannot be read
+/// or the database cannot be written.
+bool mergeIntoDatabase(ArrayRef<std::string> Inputs, StringRef OutputPath,
+                       std::string &Error);
 
 } // end serialized_diags namespace
 } // end clang namespace
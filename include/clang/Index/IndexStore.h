@@ -0,0 +1,147 @@
+//===--- IndexStore.h - Persistent symbol index -----------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file declares the index store: a directory holding, for each compiled
+// translation unit, a record of the symbol occurrences it contains, keyed by
+// USR, plus a merged lookup table over all records. Records are written
+// during compilation (-index-store-path), so a checkout that has been built
+// once can answer find-references, call hierarchy and go-to-definition
+// queries without reindexing.
+//
+//  <store>/records/<hash of main file and output>   one record per TU
+//  <store>/lookup                                   merged USR table
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_INDEX_INDEXSTORE_H
+#define LLVM_CLANG_INDEX_INDEXSTORE_H
+
+#include "clang/Basic/LLVM.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/Compiler.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace llvm {
+class MemoryBuffer;
+}
+
+namespace clang {
+class FrontendAction;
+
+namespace index {
+
+/// \brief How a symbol occurs at a location. Occurrences may have several.
+enum SymbolRole {
+  SymbolRole_Declaration = 1 << 0,
+  SymbolRole_Definition  = 1 << 1,
+  SymbolRole_Reference   = 1 << 2,
+  SymbolRole_Read        = 1 << 3,
+  SymbolRole_Write       = 1 << 4,
+  SymbolRole_Call        = 1 << 5,
+  SymbolRole_Dynamic     = 1 << 6,  ///< An ObjC message or virtual call.
+  SymbolRole_Implicit    = 1 << 7,
+
+  SymbolRole_All = (1 << 8) - 1
+};
+
+/// \brief One occurrence of a symbol.
+struct SymbolOccurrence {
+  std::string USR;
+  std::string FilePath;
+  unsigned Line;
+  unsigned Column;
+  unsigned Roles;
+  /// The USR of the function, method or type the occurrence is in, which is
+  /// what a call hierarchy walks. Empty at file scope.
+  std::string ContainerUSR;
+
+  SymbolOccurrence() : Line(0), Column(0), Roles(0) {}
+};
+
+/// \brief Collects the occurrences of one translation unit and writes them
+/// as a record of the store.
+class IndexRecordWriter {
+  std::string StorePath;
+  std::vector<SymbolOccurrence> Occurrences;
+
+public:
+  explicit IndexRecordWriter(StringRef StorePath) : StorePath(StorePath) {}
+
+  void addOccurrence(const SymbolOccurrence &Occ) {
+    Occurrences.push_back(Occ);
+  }
+
+  /// \brief Write the record of the translation unit whose main file is
+  /// \p MainFile and whose output is \p OutputFile, replacing the record of
+  /// a previous compilation of it. The record is written to a temporary
+  /// file and renamed into place, so concurrent builds may share a store.
+  ///
+  /// \returns true on error, with \p Error describing it.
+  bool writeRecord(StringRef MainFile, StringRef OutputFile,
+                   std::string &Error);
+};
+
+/// \brief Read access to an index store.
+///
+/// Lookups go through the merged table, an OnDiskChainedHashTable from USR
+/// to its occurrences built by OnDiskChainedHashTableGenerator and memory
+/// mapped, so a query costs one hash probe and reading its own occurrences.
+class IndexStore {
+  std::string StorePath;
+  std::unique_ptr<llvm::MemoryBuffer> LookupBuffer;
+  /// The OnDiskChainedHashTable over LookupBuffer.
+  void *LookupTable;
+
+  explicit IndexStore(StringRef StorePath);
+
+  IndexStore(const IndexStore &) LLVM_DELETED_FUNCTION;
+  void operator=(const IndexStore &) LLVM_DELETED_FUNCTION;
+
+public:
+  ~IndexStore();
+
+  /// \brief Open the store at \p StorePath.
+  ///
+  /// \returns null on error, with \p Error describing it.
+  static IndexStore *open(StringRef StorePath, std::string &Error);
+
+  /// \brief Whether records were written after the lookup table was built.
+  bool isLookupTableStale() const;
+
+  /// \brief Merge all records into a new lookup table and map it. Records of
+  /// translation units whose main file no longer exists are dropped.
+  ///
+  /// \returns true on error, with \p Error describing it.
+  bool rebuildLookupTable(std::string &Error);
+
+  /// \brief Append the occurrences of \p USR that have any of \p Roles to
+  /// \p Results.
+  void findOccurrences(StringRef USR, unsigned Roles,
+                       SmallVectorImpl<SymbolOccurrence> &Results) const;
+
+  /// \brief Append the occurrences that have any of \p Roles and whose
+  /// container is \p ContainerUSR, e.g. the calls a function makes.
+  void findOccurrencesInContainer(StringRef ContainerUSR, unsigned Roles,
+                                  SmallVectorImpl<SymbolOccurrence> &Results)
+      const;
+};
+
+/// \brief Wrap \p WrappedAction so that the occurrences of the translation
+/// unit it compiles are recorded in the store at \p StorePath. Used for
+/// FrontendOptions::IndexStorePath.
+FrontendAction *createIndexRecordingAction(FrontendAction *WrappedAction,
+                                           StringRef StorePath);
+
+} // namespace index
+} // namespace clang
+
+#endif
@@ -243,10 +243,26 @@ class HeaderSearch {
   /// \brief Entity used to look up stored header file information.
   ExternalHeaderFileInfoSource *ExternalSource;
   
+  /// \brief The names found in a search directory the last time it was read,
+  /// along with the directory's modification time at that point.
+  struct DirectoryContents {
+    time_t ModTime;
+    llvm::StringSet<llvm::BumpPtrAllocator> Entries;
+  };
+
+  /// \brief Cached listings of search directories, keyed by directory name.
+  ///
+  /// Each directory is read at most once per modification time; lookups of
+  /// headers and frameworks consult the listing before stat'ing candidate
+  /// paths, so the common miss in an early search directory costs a hash
+  /// lookup rather than a system call.
+  llvm::StringMap<DirectoryContents, llvm::BumpPtrAllocator> DirectoryListings;
+
   // Various statistics we track for performance analysis.
   unsigned NumIncluded;
   unsigned NumMultiIncludeFileOptzn;
   unsigned NumFrameworkLookups, NumSubFrameworkLookups;
+  unsigned NumDirectoryListingHits, NumDirectoryListingMisses;
 
   bool EnabledModules;
 
@@ -352,6 +368,12 @@ public:
   void SetExternalSource(ExternalHeaderFileInfoSource *ES) {
     ExternalSource = ES;
   }
+
+  /// \brief Retrieve the external source of header information, so that a
+  /// new source (such as an IncludeGuardCatalog) can be layered over it.
+  ExternalHeaderFileInfoSource *getExternalSource() const {
+    return ExternalSource;
+  }
   
   /// \brief Set the target information for the header search, if not
   /// already known.
@@ -417,6 +439,10 @@ public:
   ///
   /// \return false if \#including the file will have no effect or true
   /// if we should include it.
+  ///
+  /// The file's guard status may come from an external source such as an
+  /// IncludeGuardCatalog, in which case a guarded file is rejected before it
+  /// is ever opened.
   bool ShouldEnterIncludeFile(const FileEntry *File, bool isImport);
 
 
@@ -519,6 +545,28 @@ public:
   
   void IncrementFrameworkLookupCount() { ++NumFrameworkLookups; }
 
+  /// \brief Determine whether the given search directory may contain an
+  /// entry with the given name.
+  ///
+  /// Reads and caches the directory listing on first use, and re-reads it if
+  /// the directory's modification time has changed. Returns true if the
+  /// listing could not be read, so callers fall back to stat'ing the path.
+  bool mayContainEntry(const DirectoryEntry *Dir, StringRef Name);
+
+  /// \brief Load previously saved directory listings from \p Path.
+  ///
+  /// Listings whose directory modification time no longer matches are
+  /// discarded as they are looked up.
+  ///
+  /// \returns true if an error occurred.
+  bool loadDirectoryListingCache(StringRef Path);
+
+  /// \brief Save the current directory listings to \p Path so that later
+  /// compilations can reuse them.
+  ///
+  /// \returns true if an error occurred.
+  bool writeDirectoryListingCache(StringRef Path) const;
+
   /// \brief Determine whether there is a module map that may map the header
   /// with the given file name to a (sub)module.
   /// Always returns false if modules are disabled.
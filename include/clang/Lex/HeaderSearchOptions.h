@@ -92,6 +92,14 @@ public:
   /// \brief The directory used for a user build.
   std::string ModuleUserBuildPath;
 
+  /// \brief The file used to persist search directory listings between
+  /// compilations, if any.
+  std::string HeaderSearchCachePath;
+
+  /// \brief The file used to persist the include guard catalog between
+  /// compilations, if any.
+  std::string IncludeGuardCatalogPath;
+
   /// \brief Whether we should disable the use of the hash string within the
   /// module cache.
   ///
@@ -132,9 +140,19 @@ public:
   /// \brief The set of user-provided module-map-files.
   llvm::SetVector<std::string> ModuleMapFiles;
 
+  /// \brief The directory of module maps generated for frameworks that ship
+  /// without one, if any. The map for Foo.framework is looked up as
+  /// Foo.framework/module.modulemap under this directory before falling back
+  /// to module map inference, so an SDK can be used with modules without
+  /// being modified.
+  std::string ModuleMapOverlayDir;
+
   /// \brief The set of user-provided virtual filesystem overlay files.
   std::vector<std::string> VFSOverlayFiles;
 
+  /// \brief A packed SDK image to mount at the system root, if any.
+  std::string SDKImagePath;
+
   /// Include the compiler builtin includes.
   unsigned UseBuiltinIncludes : 1;
 
@@ -158,6 +176,13 @@ public:
   /// \brief Whether to validate system input files when a module is loaded.
   unsigned ModulesValidateSystemHeaders : 1;
 
+  /// \brief Whether modules are built into uniquely named temporary files
+  /// and published into the module cache with an atomic rename, rather than
+  /// built under a lock file. Readers never wait for a lock; a process that
+  /// needs a module another process is building waits for the rename to be
+  /// signalled instead of polling.
+  unsigned ModulesLockFreeCache : 1;
+
 public:
   HeaderSearchOptions(StringRef _Sysroot = "/")
     : Sysroot(_Sysroot), DisableModuleHash(0), ModuleMaps(0),
@@ -168,7 +193,7 @@ public:
       UseStandardSystemIncludes(true), UseStandardCXXIncludes(true),
       UseLibcxx(false), Verbose(false),
       ModulesValidateOncePerBuildSession(false),
-      ModulesValidateSystemHeaders(false) {}
+      ModulesValidateSystemHeaders(false), ModulesLockFreeCache(false) {}
 
   /// AddPath - Add the \p Path path to the specified \p Group list.
   void AddPath(StringRef Path, frontend::IncludeDirGroup Group,
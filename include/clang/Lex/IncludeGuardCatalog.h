@@ -0,0 +1,124 @@
+//===--- IncludeGuardCatalog.h - Persisted multiple-include info -*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// \brief Defines the IncludeGuardCatalog interface, which remembers the
+/// multiple-include status of headers across translation units.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_LEX_INCLUDEGUARDCATALOG_H
+#define LLVM_CLANG_LEX_INCLUDEGUARDCATALOG_H
+
+#include "clang/Basic/LLVM.h"
+#include "clang/Lex/HeaderSearch.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/Support/Allocator.h"
+#include <ctime>
+#include <string>
+
+namespace clang {
+
+class FileEntry;
+class IdentifierTable;
+
+/// \brief A persisted catalog of the include guards of headers, shared by
+/// all translation units built against the same catalog file.
+///
+/// MultipleIncludeOpt only learns that a header is guarded after lexing it
+/// once per translation unit. The catalog records what it learned, keyed by
+/// the header's path and validated by its size and modification time, and
+/// answers HeaderSearch's queries as an ExternalHeaderFileInfoSource. This
+/// lets HeaderSearch::ShouldEnterIncludeFile reject a guarded header whose
+/// controlling macro is already defined without opening or mapping the file.
+///
+/// Only macro guards are persisted, because they are re-validated against
+/// the definedness of the macro in each translation unit. \#pragma once and
+/// \#import only suppress the second and later inclusions within one
+/// translation unit; served from the catalog as HeaderFileInfo::isImport,
+/// they would make a fresh translation unit skip its first \#include of the
+/// header.
+///
+/// Lookups that the catalog cannot answer are forwarded to the previously
+/// installed external source (for instance, a precompiled header), so the
+/// catalog can be layered on top of one.
+class IncludeGuardCatalog : public ExternalHeaderFileInfoSource {
+public:
+  /// \brief How a header protects itself against multiple inclusion.
+  enum GuardKind {
+    GK_None,  ///< Not protected by a macro; must be re-entered.
+    GK_Macro  ///< Wrapped in \#ifndef MACRO ... \#endif.
+  };
+
+private:
+  struct Entry {
+    off_t Size;
+    time_t ModTime;
+    GuardKind Kind;
+    std::string Macro;
+  };
+
+  IdentifierTable &Identifiers;
+  ExternalHeaderFileInfoSource *Next;
+  llvm::StringMap<Entry, llvm::BumpPtrAllocator> Entries;
+
+  /// \brief Whether entries were added or replaced since the catalog was
+  /// loaded.
+  bool Dirty;
+
+  unsigned NumHits, NumStale, NumMisses;
+
+  IncludeGuardCatalog(const IncludeGuardCatalog &) LLVM_DELETED_FUNCTION;
+  void operator=(const IncludeGuardCatalog &) LLVM_DELETED_FUNCTION;
+
+public:
+  IncludeGuardCatalog(IdentifierTable &Identifiers,
+                      ExternalHeaderFileInfoSource *Next = 0)
+    : Identifiers(Identifiers), Next(Next), Dirty(false), NumHits(0),
+      NumStale(0), NumMisses(0) {}
+
+  /// \brief Load the catalog stored at \p Path.
+  ///
+  /// A missing file is not an error; the catalog simply starts out empty.
+  /// Entries for \#pragma once and \#import, written by older versions, are
+  /// dropped.
+  ///
+  /// \returns true if an error occurred.
+  bool load(StringRef Path);
+
+  /// \brief Write the catalog to \p Path if anything changed.
+  ///
+  /// The file is written to a unique temporary and renamed into place, so
+  /// concurrent compilations never observe a partially written catalog.
+  ///
+  /// \returns true if an error occurred.
+  bool write(StringRef Path) const;
+
+  /// \brief Record what MultipleIncludeOpt concluded about \p File.
+  ///
+  /// \param Macro The controlling macro, used when \p Kind is \c GK_Macro.
+  void record(const FileEntry *File, GuardKind Kind, StringRef Macro);
+
+  /// \brief Record the controlling macros of the headers seen by \p HS.
+  /// Their \#pragma once and \#import status is not recorded.
+  void recordAll(HeaderSearch &HS);
+
+  /// \brief Retrieve the catalog's header file information for \p FE.
+  ///
+  /// Entries whose size or modification time no longer match are ignored.
+  /// The result never has isImport set; at most it names the controlling
+  /// macro.
+  HeaderFileInfo GetHeaderFileInfo(const FileEntry *FE) override;
+
+  void PrintStats() const;
+};
+
+} // end namespace clang
+
+#endif
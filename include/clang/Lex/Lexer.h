@@ -576,6 +576,8 @@ private:
                           bool IsStringLiteral);
 
   // Helper functions to lex the remainder of a token of the specific type.
+  // The identifier, whitespace and comment helpers run their inner loops over
+  // the vectorized scanners in LexerScan.h.
   bool LexIdentifier         (Token &Result, const char *CurPtr);
   bool LexNumericConstant    (Token &Result, const char *CurPtr);
   bool LexStringLiteral      (Token &Result, const char *CurPtr,
@@ -600,6 +602,17 @@ private:
   bool isCodeCompletionPoint(const char *CurPtr) const;
   void cutOffLexing() { BufferPtr = BufferEnd; }
 
+  /// \brief Advance BufferPtr over excluded code to the next line whose first
+  /// token is a directive introducer, without forming tokens.
+  ///
+  /// Used by Preprocessor::SkipExcludedConditionalBlock so that the cost of a
+  /// skipped region is proportional to its line count. Leaves BufferPtr at
+  /// the '#' with IsAtStartOfLine set, or at the end of the buffer.
+  ///
+  /// \returns false if trigraphs are enabled and the caller must lex the
+  /// region token by token instead.
+  bool skipToNextDirectiveLine();
+
   bool isHexaLiteral(const char *Start, const LangOptions &LangOpts);
 
 
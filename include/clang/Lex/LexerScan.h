@@ -0,0 +1,378 @@
+//===--- LexerScan.h - Vectorized character scanning for the Lexer -*- C++ -*-//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file defines the character scanning primitives used by the Lexer's hot
+// loops: skipping horizontal whitespace, identifier bodies and block comment
+// text, and stepping over excluded conditional blocks line by line. On hosts
+// with SSE2 or AArch64 NEON they examine 16 bytes per step; elsewhere they
+// fall back to the CharInfo table.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_LEXERSCAN_H
+#define LLVM_CLANG_LEXERSCAN_H
+
+#include "clang/Basic/CharInfo.h"
+#include "llvm/Support/Compiler.h"
+#include "llvm/Support/MathExtras.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CLANG_LEXER_SCAN_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define CLANG_LEXER_SCAN_NEON 1
+#endif
+
+namespace clang {
+namespace lexscan {
+
+/// \brief Width, in bytes, of one vector step.
+enum { VectorWidth = 16 };
+
+#if defined(CLANG_LEXER_SCAN_SSE2)
+/// \brief Return a mask with one bit set for each byte of \p Chunk that is
+/// \b not a space or horizontal tab.
+LLVM_READONLY static inline unsigned nonBlankMask(__m128i Chunk) {
+  __m128i Blank = _mm_or_si128(_mm_cmpeq_epi8(Chunk, _mm_set1_epi8(' ')),
+                               _mm_cmpeq_epi8(Chunk, _mm_set1_epi8('\t')));
+  return ~_mm_movemask_epi8(Blank) & 0xFFFF;
+}
+
+/// \brief Return a mask with one bit set for each byte of \p Chunk that is
+/// \b not one of [a-zA-Z0-9_].
+LLVM_READONLY static inline unsigned nonIdentifierBodyMask(__m128i Chunk) {
+  // Folding to lowercase maps A-Z onto a-z and leaves digits and '_' alone.
+  // Bytes >= 0x80 compare as negative and fall outside every range.
+  __m128i Lower = _mm_or_si128(Chunk, _mm_set1_epi8(0x20));
+  __m128i IsAlpha =
+      _mm_and_si128(_mm_cmpgt_epi8(Lower, _mm_set1_epi8('a' - 1)),
+                    _mm_cmplt_epi8(Lower, _mm_set1_epi8('z' + 1)));
+  __m128i IsDigit =
+      _mm_and_si128(_mm_cmpgt_epi8(Chunk, _mm_set1_epi8('0' - 1)),
+                    _mm_cmplt_epi8(Chunk, _mm_set1_epi8('9' + 1)));
+  __m128i IsUnder = _mm_cmpeq_epi8(Chunk, _mm_set1_epi8('_'));
+  __m128i Body = _mm_or_si128(_mm_or_si128(IsAlpha, IsDigit), IsUnder);
+  return ~_mm_movemask_epi8(Body) & 0xFFFF;
+}
+#endif
+
+/// \brief Return the first character in [Ptr, End) that is not a space or
+/// horizontal tab, or \p End if there is none.
+///
+/// This covers the overwhelmingly common indentation case; the caller still
+/// handles '\\f', '\\v' and vertical whitespace with the CharInfo table.
+LLVM_READONLY static inline const char *
+skipBlanks(const char *Ptr, const char *End) {
+#if defined(CLANG_LEXER_SCAN_SSE2)
+  while (End - Ptr >= VectorWidth) {
+    __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Ptr));
+    if (unsigned Mask = nonBlankMask(Chunk))
+      return Ptr + llvm::countTrailingZeros(Mask);
+    Ptr += VectorWidth;
+  }
+#elif defined(CLANG_LEXER_SCAN_NEON)
+  while (End - Ptr >= VectorWidth) {
+    uint8x16_t Chunk = vld1q_u8(reinterpret_cast<const uint8_t *>(Ptr));
+    uint8x16_t Blank = vorrq_u8(vceqq_u8(Chunk, vdupq_n_u8(' ')),
+                                vceqq_u8(Chunk, vdupq_n_u8('\t')));
+    if (vminvq_u8(Blank) == 0)
+      break;
+    Ptr += VectorWidth;
+  }
+#endif
+  while (Ptr != End && (*Ptr == ' ' || *Ptr == '\t'))
+    ++Ptr;
+  return Ptr;
+}
+
+/// \brief Return the first character in [Ptr, End) that is not one of
+/// [a-zA-Z0-9_], or \p End if there is none.
+///
+/// '$', UCNs and UTF-8 continue an identifier only under language options the
+/// caller checks, so they stop the scan here.
+LLVM_READONLY static inline const char *
+skipIdentifierBody(const char *Ptr, const char *End) {
+#if defined(CLANG_LEXER_SCAN_SSE2)
+  while (End - Ptr >= VectorWidth) {
+    __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Ptr));
+    if (unsigned Mask = nonIdentifierBodyMask(Chunk))
+      return Ptr + llvm::countTrailingZeros(Mask);
+    Ptr += VectorWidth;
+  }
+#elif defined(CLANG_LEXER_SCAN_NEON)
+  while (End - Ptr >= VectorWidth) {
+    uint8x16_t Chunk = vld1q_u8(reinterpret_cast<const uint8_t *>(Ptr));
+    uint8x16_t Lower = vorrq_u8(Chunk, vdupq_n_u8(0x20));
+    uint8x16_t IsAlpha = vcleq_u8(vsubq_u8(Lower, vdupq_n_u8('a')),
+                                  vdupq_n_u8('z' - 'a'));
+    uint8x16_t IsDigit = vcleq_u8(vsubq_u8(Chunk, vdupq_n_u8('0')),
+                                  vdupq_n_u8('9' - '0'));
+    uint8x16_t IsUnder = vceqq_u8(Chunk, vdupq_n_u8('_'));
+    if (vminvq_u8(vorrq_u8(vorrq_u8(IsAlpha, IsDigit), IsUnder)) == 0)
+      break;
+    Ptr += VectorWidth;
+  }
+#endif
+  while (Ptr != End && isIdentifierBody(*Ptr))
+    ++Ptr;
+  return Ptr;
+}
+
+/// \brief Return the first character in [Ptr, End) that could end a block
+/// comment or needs attention from the slow path, or \p End if there is none.
+///
+/// Stops at '/' (a possible "*/", possibly split by an escaped newline), at
+/// '\\0' (end of buffer or code completion point), and at '\\n' and '\\r' so
+/// that the caller can keep track of line starts.
+LLVM_READONLY static inline const char *
+findBlockCommentBreak(const char *Ptr, const char *End) {
+#if defined(CLANG_LEXER_SCAN_SSE2)
+  const __m128i Slash = _mm_set1_epi8('/');
+  const __m128i Nul = _mm_setzero_si128();
+  const __m128i LF = _mm_set1_epi8('\n');
+  const __m128i CR = _mm_set1_epi8('\r');
+  while (End - Ptr >= VectorWidth) {
+    __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Ptr));
+    __m128i Hit = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(Chunk, Slash), _mm_cmpeq_epi8(Chunk, Nul)),
+        _mm_or_si128(_mm_cmpeq_epi8(Chunk, LF), _mm_cmpeq_epi8(Chunk, CR)));
+    if (unsigned Mask = _mm_movemask_epi8(Hit))
+      return Ptr + llvm::countTrailingZeros(Mask);
+    Ptr += VectorWidth;
+  }
+#elif defined(CLANG_LEXER_SCAN_NEON)
+  while (End - Ptr >= VectorWidth) {
+    uint8x16_t Chunk = vld1q_u8(reinterpret_cast<const uint8_t *>(Ptr));
+    uint8x16_t Hit = vorrq_u8(
+        vorrq_u8(vceqq_u8(Chunk, vdupq_n_u8('/')), vceqzq_u8(Chunk)),
+        vorrq_u8(vceqq_u8(Chunk, vdupq_n_u8('\n')),
+                 vceqq_u8(Chunk, vdupq_n_u8('\r'))));
+    if (vmaxvq_u8(Hit) != 0)
+      break;
+    Ptr += VectorWidth;
+  }
+#endif
+  while (Ptr != End && *Ptr != '/' && *Ptr != '\0' && *Ptr != '\n' &&
+         *Ptr != '\r')
+    ++Ptr;
+  return Ptr;
+}
+
+/// \brief Return the first character in [Ptr, End) that could change the
+/// meaning of the rest of a line in excluded code, or \p End if there is none.
+///
+/// Stops at comment and literal introducers ('/', '"', '\''), at '\\' (a
+/// possible escaped newline), at '\\0', and at '\\n' and '\\r'.
+LLVM_READONLY static inline const char *
+findLineBodyBreak(const char *Ptr, const char *End) {
+#if defined(CLANG_LEXER_SCAN_SSE2)
+  while (End - Ptr >= VectorWidth) {
+    __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Ptr));
+    __m128i Hit = _mm_or_si128(
+        _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(Chunk, _mm_set1_epi8('/')),
+                         _mm_cmpeq_epi8(Chunk, _mm_set1_epi8('"'))),
+            _mm_or_si128(_mm_cmpeq_epi8(Chunk, _mm_set1_epi8('\'')),
+                         _mm_cmpeq_epi8(Chunk, _mm_set1_epi8('\\')))),
+        _mm_or_si128(
+            _mm_cmpeq_epi8(Chunk, _mm_setzero_si128()),
+            _mm_or_si128(_mm_cmpeq_epi8(Chunk, _mm_set1_epi8('\n')),
+                         _mm_cmpeq_epi8(Chunk, _mm_set1_epi8('\r')))));
+    if (unsigned Mask = _mm_movemask_epi8(Hit))
+      return Ptr + llvm::countTrailingZeros(Mask);
+    Ptr += VectorWidth;
+  }
+#elif defined(CLANG_LEXER_SCAN_NEON)
+  while (End - Ptr >= VectorWidth) {
+    uint8x16_t Chunk = vld1q_u8(reinterpret_cast<const uint8_t *>(Ptr));
+    uint8x16_t Hit = vorrq_u8(
+        vorrq_u8(vorrq_u8(vceqq_u8(Chunk, vdupq_n_u8('/')),
+                          vceqq_u8(Chunk, vdupq_n_u8('"'))),
+                 vorrq_u8(vceqq_u8(Chunk, vdupq_n_u8('\'')),
+                          vceqq_u8(Chunk, vdupq_n_u8('\\')))),
+        vorrq_u8(vceqzq_u8(Chunk),
+                 vorrq_u8(vceqq_u8(Chunk, vdupq_n_u8('\n')),
+                          vceqq_u8(Chunk, vdupq_n_u8('\r')))));
+    if (vmaxvq_u8(Hit) != 0)
+      break;
+    Ptr += VectorWidth;
+  }
+#endif
+  for (; Ptr != End; ++Ptr) {
+    switch (*Ptr) {
+    case '/': case '"': case '\'': case '\\':
+    case '\0': case '\n': case '\r':
+      return Ptr;
+    default:
+      break;
+    }
+  }
+  return Ptr;
+}
+
+/// \brief Whether the '\\' at \p Ptr starts an escaped newline: a line
+/// splice, possibly with blanks between the backslash and the line break.
+LLVM_READONLY static inline bool isEscapedNewline(const char *Ptr,
+                                                  const char *End) {
+  const char *After = skipBlanks(Ptr + 1, End);
+  return After != End && (*After == '\n' || *After == '\r');
+}
+
+/// \brief Whether the '/' at \p Slash closes a block comment whose text
+/// starts at \p Body, just past the "/*".
+///
+/// The '*' must come from the comment text, so "/*/" does not close, and it
+/// may be separated from the '/' by escaped newlines, as in "*\\<newline>/".
+static inline bool closesBlockComment(const char *Slash, const char *Body) {
+  const char *Ptr = Slash;
+  while (Ptr != Body) {
+    char C = Ptr[-1];
+    if (C != '\n' && C != '\r')
+      return C == '*';
+    // Step back over one line break, "\r\n" and "\n\r" included, the blanks
+    // before it and the backslash that escapes it.
+    --Ptr;
+    if (Ptr != Body && (Ptr[-1] == '\n' || Ptr[-1] == '\r') && Ptr[-1] != C)
+      --Ptr;
+    while (Ptr != Body && (Ptr[-1] == ' ' || Ptr[-1] == '\t'))
+      --Ptr;
+    if (Ptr == Body || Ptr[-1] != '\\')
+      return false;
+    --Ptr;
+  }
+  return false;
+}
+
+/// \brief Scan excluded code starting at \p Ptr for the next line whose first
+/// token is '#' (or the "%:" digraph), without forming any tokens.
+///
+/// Comments and string and character literals are stepped over so that a
+/// '#' inside them is not mistaken for a directive; as in raw lexing, an
+/// unterminated literal ends at the end of its line. Trigraphs are not
+/// recognized, so callers must not use this when they are enabled.
+///
+/// Line splices are left to the caller's slow path: a splice at the start
+/// of a line can still be followed by the '#' of a directive, and one
+/// inside a literal or line comment continues it onto the next line. Only
+/// the splices inside block comments, which cannot change where the comment
+/// ends except in "*\\<newline>/", are stepped over here.
+///
+/// \param AtLineStart Whether \p Ptr is at the start of a logical line.
+///
+/// \returns a pointer to the directive introducer, or \p End. A '\\0' that is
+/// not at \p End is also returned so the caller can check for a code
+/// completion point, and so is the '\\' of any escaped newline outside a
+/// block comment, which the caller must lex with the slow path.
+static inline const char *findNextDirectiveLine(const char *Ptr,
+                                                const char *End,
+                                                bool AtLineStart) {
+  while (Ptr != End) {
+    if (AtLineStart) {
+      Ptr = skipBlanks(Ptr, End);
+      if (Ptr == End)
+        return End;
+      if (*Ptr == '#' || (*Ptr == '%' && Ptr + 1 != End && Ptr[1] == ':'))
+        return Ptr;
+      if (*Ptr == '\f' || *Ptr == '\v') {
+        ++Ptr;
+        continue;
+      }
+      if (*Ptr == '\\' && isEscapedNewline(Ptr, End))
+        return Ptr;
+    }
+
+    // Scan the remainder of the line. A line that so far holds only blanks
+    // and comments is still at its start for the purpose of directives.
+    bool OnlyBlanksSoFar = AtLineStart;
+    AtLineStart = false;
+    const char *Break = findLineBodyBreak(Ptr, End);
+    if (Break != Ptr)
+      OnlyBlanksSoFar = false;
+    Ptr = Break;
+    if (Ptr == End)
+      return End;
+
+    switch (*Ptr) {
+    case '\0':
+      return Ptr;
+    case '\n':
+    case '\r':
+      // Treat "\r\n" and "\n\r" as a single line break.
+      if (Ptr + 1 != End && (Ptr[1] == '\n' || Ptr[1] == '\r') &&
+          Ptr[1] != Ptr[0])
+        ++Ptr;
+      ++Ptr;
+      AtLineStart = true;
+      continue;
+    case '\\':
+      // An escaped newline joins two lines; leave it to the slow path.
+      if (isEscapedNewline(Ptr, End))
+        return Ptr;
+      ++Ptr;
+      continue;
+    case '"':
+    case '\'': {
+      char Quote = *Ptr++;
+      while (Ptr != End && *Ptr != Quote && *Ptr != '\n' && *Ptr != '\r' &&
+             *Ptr != '\0') {
+        if (*Ptr == '\\') {
+          if (isEscapedNewline(Ptr, End))
+            return Ptr;
+          if (Ptr + 1 != End)
+            ++Ptr;
+        }
+        ++Ptr;
+      }
+      if (Ptr != End && *Ptr == Quote)
+        ++Ptr;
+      continue;
+    }
+    case '/':
+      if (Ptr + 1 != End && Ptr[1] == '/') {
+        // Line comment: skip to the end of the line. An escaped newline
+        // continues the comment; leave it to the slow path.
+        Ptr += 2;
+        while (Ptr != End && *Ptr != '\n' && *Ptr != '\r' && *Ptr != '\0') {
+          if (*Ptr == '\\' && isEscapedNewline(Ptr, End))
+            return Ptr;
+          ++Ptr;
+        }
+        continue;
+      }
+      if (Ptr + 1 != End && Ptr[1] == '*') {
+        // Block comment: find the closing "*/". Line breaks inside the
+        // comment do not start a new line for directive purposes.
+        Ptr += 2;
+        const char *Body = Ptr;
+        for (;;) {
+          Ptr = findBlockCommentBreak(Ptr, End);
+          if (Ptr == End || *Ptr == '\0')
+            return Ptr;
+          if (*Ptr == '/' && closesBlockComment(Ptr, Body)) {
+            ++Ptr;
+            break;
+          }
+          ++Ptr;
+        }
+        AtLineStart = OnlyBlanksSoFar;
+        continue;
+      }
+      ++Ptr;
+      continue;
+    }
+  }
+  return Ptr;
+}
+
+} // end namespace lexscan
+} // end namespace clang
+
+#endif
@@ -0,0 +1,126 @@
+//===--- MacroExpansionCache.h - Reusable macro substitutions ---*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file defines the MacroExpansionCache class, which remembers how the
+// body of a function-like macro was substituted for a given shape of
+// arguments so that later invocations can replay the substitution.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_MACROEXPANSIONCACHE_H
+#define LLVM_CLANG_MACROEXPANSIONCACHE_H
+
+#include "clang/Basic/LLVM.h"
+#include "clang/Basic/SourceLocation.h"
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/FoldingSet.h"
+#include "llvm/Support/Allocator.h"
+
+namespace clang {
+
+class MacroArgs;
+class MacroInfo;
+class Preprocessor;
+class Token;
+
+/// \brief Caches the result of TokenLexer::ExpandFunctionArguments as a
+/// substitution plan.
+///
+/// When no argument of an invocation needs pre-expansion, the token sequence
+/// produced by substituting the arguments into a macro body depends only on
+/// the macro and on the length of each argument: every resulting token is
+/// either a body token, a token of some argument, or a stringified argument.
+/// The plan records that origin for each result token, so invocations with
+/// the same argument shape copy tokens directly instead of re-running the
+/// substitution logic, including the ## and __VA_ARGS__ comma rules.
+///
+/// Plans are allocated from an arena owned by the cache. Plans for a macro are
+/// dropped when the Preprocessor releases its MacroInfo.
+class MacroExpansionCache {
+public:
+  /// \brief Where one token of a substituted macro body comes from.
+  struct TokenOrigin {
+    enum OriginKind {
+      OK_BodyToken,      ///< Index is a token of the macro body.
+      OK_ArgToken,       ///< Token Index of argument Arg.
+      OK_StringifiedArg, ///< The stringified form of argument Arg.
+      OK_CharifiedArg    ///< The charified (#@) form of argument Arg.
+    };
+    unsigned Kind : 2;
+    unsigned Arg : 30;
+    unsigned Index;
+    /// \brief Whether the token should have a leading space, as decided by
+    /// the substitution.
+    bool LeadingSpace;
+  };
+
+  /// \brief A recorded substitution.
+  struct Plan : llvm::FoldingSetNode {
+    const MacroInfo *Macro;
+    ArrayRef<unsigned> ArgLengths;
+    bool VarargsElided;
+    ArrayRef<TokenOrigin> Origins;
+
+    void Profile(llvm::FoldingSetNodeID &ID) const {
+      Profile(ID, Macro, ArgLengths, VarargsElided);
+    }
+    static void Profile(llvm::FoldingSetNodeID &ID, const MacroInfo *Macro,
+                        ArrayRef<unsigned> ArgLengths, bool VarargsElided);
+  };
+
+private:
+  llvm::BumpPtrAllocator Arena;
+  llvm::FoldingSet<Plan> Plans;
+
+  /// \brief The plans recorded for each macro, so they can be dropped when
+  /// the macro is released.
+  llvm::DenseMap<const MacroInfo *, SmallVector<Plan *, 2> > PlansByMacro;
+
+  unsigned NumLookups, NumHits;
+
+  MacroExpansionCache(const MacroExpansionCache &) LLVM_DELETED_FUNCTION;
+  void operator=(const MacroExpansionCache &) LLVM_DELETED_FUNCTION;
+
+public:
+  MacroExpansionCache() : NumLookups(0), NumHits(0) {}
+
+  /// \brief Find the plan for invoking \p MI with \p Args, if one was
+  /// recorded.
+  ///
+  /// Returns null if there is none, or if some argument needs pre-expansion
+  /// and the invocation cannot be planned at all.
+  const Plan *lookup(const MacroInfo *MI, MacroArgs *Args, Preprocessor &PP);
+
+  /// \brief Record how \p MI was substituted for \p Args.
+  void record(const MacroInfo *MI, MacroArgs *Args,
+              ArrayRef<TokenOrigin> Origins);
+
+  /// \brief Append the tokens described by \p P for the invocation \p Args
+  /// to \p ResultToks.
+  ///
+  /// The caller hands the result to Preprocessor::cacheMacroExpandedTokens,
+  /// exactly as it would a freshly substituted body.
+  void replay(const Plan &P, MacroArgs *Args, Preprocessor &PP,
+              SourceLocation ExpansionLocStart,
+              SourceLocation ExpansionLocEnd,
+              SmallVectorImpl<Token> &ResultToks);
+
+  /// \brief Drop every plan recorded for \p MI.
+  void invalidate(const MacroInfo *MI);
+
+  unsigned getNumLookups() const { return NumLookups; }
+  unsigned getNumHits() const { return NumHits; }
+
+  size_t getTotalMemory() const { return Arena.getTotalMemory(); }
+};
+
+} // end namespace clang
+
+#endif
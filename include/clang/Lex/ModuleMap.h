@@ -333,6 +333,21 @@ public:
                                const DirectoryEntry *FrameworkDir,
                                bool IsSystem, Module *Parent);
   
+  /// \brief Write a module map for the framework in \p FrameworkDir, which
+  /// does not provide one, to \p OS.
+  ///
+  /// The map has an umbrella header module for the framework, with a
+  /// submodule for each header the umbrella header does not include, and a
+  /// private module for the PrivateHeaders directory if there is one. Every
+  /// module exports everything and links the framework. Headers that fail
+  /// to parse on their own are excluded instead. Tools that generate maps
+  /// for an SDK store the result in a HeaderSearchOptions
+  /// ModuleMapOverlayDir.
+  ///
+  /// \returns true if an error occurred; no map is written.
+  bool writeFrameworkModuleMap(const DirectoryEntry *FrameworkDir,
+                               bool IsSystem, raw_ostream &OS);
+
   /// \brief Retrieve the module map file containing the definition of the given
   /// module.
   ///
@@ -0,0 +1,113 @@
+//===--- PTHTokenCache.h - Shared PTH cache for system headers --*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+//  This file defines the PTHTokenCache interface, which automatically
+//  pretokenizes system headers into a content-addressed, memory-mapped cache
+//  shared by concurrent compiler processes.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_PTHTOKENCACHE_H
+#define LLVM_CLANG_PTHTOKENCACHE_H
+
+#include "clang/Basic/LLVM.h"
+#include "clang/Basic/SourceLocation.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/Timer.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace clang {
+
+class DiagnosticsEngine;
+class FileEntry;
+class LangOptions;
+class PTHLexer;
+class PTHManager;
+class Preprocessor;
+
+/// \brief An automatic token cache for headers under the system root.
+///
+/// Where PTHManager serves a single explicit -include-pth file, the token
+/// cache keeps one PTH file per header in a cache directory. Each file is
+/// named by a hash of the header's contents together with the language
+/// options and predefines that affect lexing, so a cache entry never goes
+/// stale and can be shared by every compilation that uses the same SDK.
+///
+/// Cache files are mapped read-only and are never modified after they are
+/// published; new entries are written to a unique temporary file and renamed
+/// into place, so concurrent processes need no locking. Headers that miss
+/// the cache are lexed normally and queued, and are pretokenized by
+/// writeMissingEntries() once the translation unit has been processed.
+///
+/// Time spent consulting and filling the cache is reported by -ftime-report
+/// under the "Token cache" timer group.
+class PTHTokenCache {
+  std::string CacheDir;
+  std::string Sysroot;
+
+  /// \brief Hash of the options that affect lexing, mixed into every key.
+  std::string ConfigHash;
+
+  DiagnosticsEngine &Diags;
+
+  /// \brief The mapped cache entries opened so far, one per header.
+  llvm::DenseMap<const FileEntry *, PTHManager *> Managers;
+
+  /// \brief Headers under the system root that missed the cache.
+  std::vector<const FileEntry *> Missing;
+
+  llvm::TimerGroup Timers;
+  llvm::Timer LookupTimer;
+  llvm::Timer WriteTimer;
+
+  unsigned NumHits, NumMisses, NumWritten;
+
+  PTHTokenCache(const PTHTokenCache &) LLVM_DELETED_FUNCTION;
+  void operator=(const PTHTokenCache &) LLVM_DELETED_FUNCTION;
+
+  /// \brief Compute the cache file name for \p File.
+  ///
+  /// \returns false if the file could not be read.
+  bool getEntryPath(const FileEntry *File, SmallVectorImpl<char> &Path);
+
+public:
+  /// \brief Create a token cache rooted at \p CacheDir for headers under
+  /// \p Sysroot.
+  ///
+  /// \param EnableTimers Whether to record time for -ftime-report.
+  PTHTokenCache(StringRef CacheDir, StringRef Sysroot,
+                const LangOptions &LangOpts, StringRef Predefines,
+                DiagnosticsEngine &Diags, bool EnableTimers);
+  ~PTHTokenCache();
+
+  /// \brief Whether \p File lives under the system root and is therefore
+  /// eligible for caching.
+  bool isCacheable(const FileEntry *File) const;
+
+  /// \brief Return a lexer that replays the cached tokens of \p File, which
+  /// has been entered as \p FID, or null if the cache has no entry for it.
+  ///
+  /// A miss is remembered so the entry can be written later.
+  PTHLexer *createLexer(Preprocessor &PP, FileID FID, const FileEntry *File);
+
+  /// \brief Pretokenize every header that missed the cache and publish the
+  /// results.
+  ///
+  /// \returns the number of entries written.
+  unsigned writeMissingEntries(Preprocessor &PP);
+
+  void PrintStats() const;
+};
+
+} // end namespace clang
+
+#endif
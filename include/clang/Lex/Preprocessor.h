@@ -20,6 +20,7 @@
 #include "clang/Basic/IdentifierTable.h"
 #include "clang/Basic/SourceLocation.h"
 #include "clang/Lex/Lexer.h"
+#include "clang/Lex/MacroExpansionCache.h"
 #include "clang/Lex/MacroInfo.h"
 #include "clang/Lex/ModuleMap.h"
 #include "clang/Lex/PPCallbacks.h"
@@ -57,6 +58,7 @@ class DirectoryLookup;
 class PreprocessingRecord;
 class ModuleLoader;
 class PreprocessorOptions;
+class PTHTokenCache;
 
 /// \brief Stores token information for comparing actual tokens with
 /// predefined values.  Only handles simple tokens and identifiers.
@@ -104,6 +106,10 @@ class Preprocessor : public RefCountedBase<Preprocessor> {
   /// a token cache rather than lexing the original source file.
   std::unique_ptr<PTHManager> PTH;
 
+  /// An optional automatic token cache for system headers, consulted when a
+  /// header under the system root is entered.
+  std::unique_ptr<PTHTokenCache> SystemTokenCache;
+
   /// A BumpPtrAllocator object used to quickly allocate and release
   /// objects internal to the Preprocessor.
   llvm::BumpPtrAllocator BP;
@@ -378,7 +384,8 @@ class Preprocessor : public RefCountedBase<Preprocessor> {
   unsigned NumEnteredSourceFiles, MaxIncludeStackDepth;
   unsigned NumMacroExpanded, NumFnMacroExpanded, NumBuiltinMacroExpanded;
   unsigned NumFastMacroExpanded, NumTokenPaste, NumFastTokenPaste;
-  unsigned NumSkipped;
+  unsigned NumReplayedMacroExpansions;
+  unsigned NumSkipped, NumRawSkippedLines;
 
   /// \brief The predefined macros that preprocessor should use from the
   /// command line etc.
@@ -402,6 +409,10 @@ class Preprocessor : public RefCountedBase<Preprocessor> {
   SmallVector<Token, 16> MacroExpandedTokens;
   std::vector<std::pair<TokenLexer *, size_t> > MacroExpandingLexersStack;
 
+  /// \brief Substitution plans for function-like macro invocations, replayed
+  /// by TokenLexer::ExpandFunctionArguments for repeated argument shapes.
+  MacroExpansionCache ExpansionCache;
+
   /// \brief A record of the macro definitions and expansions that
   /// occurred during preprocessing.
   ///
@@ -494,6 +505,12 @@ public:
 
   PTHManager *getPTHManager() { return PTH.get(); }
 
+  /// \brief Install the automatic token cache for system headers. The
+  /// preprocessor takes ownership.
+  void setSystemTokenCache(PTHTokenCache *TC);
+
+  PTHTokenCache *getSystemTokenCache() { return SystemTokenCache.get(); }
+
   void setExternalSource(ExternalPreprocessorSource *Source) {
     ExternalSource = Source;
   }
@@ -1376,7 +1393,8 @@ private:
 
   /// \brief Release the specified MacroInfo for re-use.
   ///
-  /// This memory will  be reused for allocating new MacroInfo objects.
+  /// This memory will  be reused for allocating new MacroInfo objects. Any
+  /// cached substitution plans for the macro are dropped.
   void ReleaseMacroInfo(MacroInfo* MI);
 
   /// \brief Lex and validate a macro name, which occurs after a
@@ -1400,6 +1418,10 @@ private:
   /// \p FoundElse is false, then \#else directives are ok, if not, then we have
   /// already seen one so a \#else directive is a duplicate.  When this returns,
   /// the caller can lex the first valid token.
+  ///
+  /// When lexing from a raw buffer without trigraphs, excluded lines are
+  /// stepped over with Lexer::skipToNextDirectiveLine and only directive lines
+  /// are tokenized.
   void SkipExcludedConditionalBlock(SourceLocation IfTokenLoc,
                                     bool FoundNonSkipPortion, bool FoundElse,
                                     SourceLocation ElseLoc = SourceLocation());
@@ -61,6 +61,20 @@ public:
   /// \brief Headers that will be converted to chained PCHs in memory.
   std::vector<std::string> ChainedIncludes;
 
+  /// \brief If non-empty, the directory of automatically built prefix PCHs
+  /// (-fauto-prefix-pch-dir).
+  ///
+  /// The leading run of #import and #include directives of the main file is
+  /// hashed together with the macro definitions from the command line and
+  /// the language options. A PCH for that hash in this directory is used as
+  /// if it had been given as ImplicitPCHInclude, and the directives it
+  /// covers are skipped. Otherwise one is built, chained through the same
+  /// machinery as ChainedIncludes, written with ASTWriter, and published by
+  /// rename for later translation units. A PCH that fails validation, for
+  /// example because a header was changed, is ignored and the directives
+  /// are processed textually.
+  std::string AutoPCHDir;
+
   /// \brief When true, disables most of the normal validation performed on
   /// precompiled headers.
   bool DisablePCHValidation;
@@ -89,6 +103,10 @@ public:
   /// If given, a PTH cache file to use for speeding up header parsing.
   std::string TokenCache;
 
+  /// If given, a directory holding the automatic token cache for headers
+  /// under the system root (see PTHTokenCache).
+  std::string SystemTokenCacheDir;
+
   /// \brief True if the SourceManager should report the original file name for
   /// contents of files that were remapped to other files. Defaults to true.
   bool RemappedFilesKeepOriginalName;
@@ -218,6 +236,7 @@ public:
     Includes.clear();
     MacroIncludes.clear();
     ChainedIncludes.clear();
+    AutoPCHDir.clear();
     DumpDeserializedPCHDecls = false;
     ImplicitPCHInclude.clear();
     ImplicitPTHInclude.clear();
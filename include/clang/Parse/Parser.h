@@ -21,6 +21,7 @@
 #include "clang/Lex/Preprocessor.h"
 #include "clang/Sema/DeclSpec.h"
 #include "clang/Sema/Sema.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/Support/Compiler.h"
 #include "llvm/Support/PrettyStackTrace.h"
@@ -218,6 +219,9 @@ class Parser : public CodeCompletionHandler {
   /// \brief Identifiers which have been declared within a tentative parse.
   SmallVector<IdentifierInfo *, 8> TentativelyDeclaredIdentifiers;
 
+  /// \brief The number of TentativeParsingActions currently active.
+  unsigned TentativeParsingDepth;
+
   IdentifierInfo *getSEHExceptKeyword();
 
   /// True if we are within an Objective-C container while parsing C-like decls.
@@ -229,14 +233,40 @@ class Parser : public CodeCompletionHandler {
 
   bool SkipFunctionBodies;
 
+  /// \brief Whether function bodies in the main file are parsed even when
+  /// SkipFunctionBodies is set.
+  bool KeepMainFileFunctionBodies;
+
+  /// \brief Determine whether the body of a function whose '{' is at \p Loc
+  /// should be skipped by brace matching rather than parsed.
+  bool shouldSkipFunctionBody(SourceLocation Loc) const;
+
+  /// \brief Whether the bodies of Objective-C method definitions are parsed
+  /// at the end of the translation unit rather than at \@end.
+  ///
+  /// This changes the meaning of some programs, so it is off unless
+  /// -fdefer-objc-method-bodies is passed to -cc1. A deferred body sees the
+  /// file-scope declarations that follow the \@end, which a body parsed at
+  /// \@end would not, and it is parsed in the pragma state of the end of
+  /// the translation unit (\#pragma clang diagnostic, pack, options align,
+  /// ...) rather than the state at its \@implementation.
+  bool DeferObjCMethodBodies;
+
 public:
-  Parser(Preprocessor &PP, Sema &Actions, bool SkipFunctionBodies);
+  Parser(Preprocessor &PP, Sema &Actions, bool SkipFunctionBodies,
+         bool DeferObjCMethodBodies = false);
   ~Parser();
 
   const LangOptions &getLangOpts() const { return PP.getLangOpts(); }
   const TargetInfo &getTargetInfo() const { return PP.getTargetInfo(); }
   Preprocessor &getPreprocessor() const { return PP; }
   Sema &getActions() const { return Actions; }
+
+  /// \brief When function bodies are skipped, still parse those in the main
+  /// file.
+  void setKeepMainFileFunctionBodies(bool Keep) {
+    KeepMainFileFunctionBodies = Keep;
+  }
   AttributeFactory &getAttrFactory() { return AttrFactory; }
 
   const Token &getCurToken() const { return Tok; }
@@ -280,6 +310,10 @@ public:
 
   /// ParseTopLevelDecl - Parse one top-level declaration. Returns true if
   /// the EOF was encountered.
+  ///
+  /// When Objective-C method bodies are deferred, reaching the end of the
+  /// file first parses every deferred body; the \@implementations they belong
+  /// to are then returned in \p Result, one per call, before EOF is reported.
   bool ParseTopLevelDecl(DeclGroupPtrTy &Result);
   bool ParseTopLevelDecl() {
     DeclGroupPtrTy Result;
@@ -660,6 +694,7 @@ private:
       PrevBracketCount = P.BracketCount;
       PrevBraceCount = P.BraceCount;
       P.PP.EnableBacktrackAtThisPos();
+      ++P.TentativeParsingDepth;
       isActive = true;
     }
     void Commit() {
@@ -667,6 +702,7 @@ private:
       P.TentativelyDeclaredIdentifiers.resize(
           PrevTentativelyDeclaredIdentifierCount);
       P.PP.CommitBacktrackedTokens();
+      P.LeaveTentativeParse();
       isActive = false;
     }
     void Revert() {
@@ -678,6 +714,7 @@ private:
       P.ParenCount = PrevParenCount;
       P.BracketCount = PrevBracketCount;
       P.BraceCount = PrevBraceCount;
+      P.LeaveTentativeParse();
       isActive = false;
     }
     ~TentativeParsingAction() {
@@ -1273,6 +1310,25 @@ private:
   ObjCImplParsingDataRAII *CurParsedObjCImpl;
   void StashAwayMethodOrFunctionBodyTokens(Decl *MDecl);
 
+  /// \brief An \@implementation whose method bodies have been stashed until
+  /// the end of the translation unit, together with the declarations that
+  /// are handed to the ASTConsumer once those bodies have been parsed.
+  struct DeferredObjCImpl {
+    SmallVector<LexedMethod *, 8> Methods;
+    DeclGroupPtrTy Decls;
+  };
+
+  /// \brief The \@implementations deferred so far, in source order.
+  SmallVector<DeferredObjCImpl *, 4> DeferredObjCImpls;
+
+  /// \brief Parse the bodies of every deferred \@implementation, in source
+  /// order.
+  ///
+  /// Method bodies only depend on declarations, which are all complete by
+  /// the end of the translation unit, so the queue is a natural unit of work
+  /// for scheduling body analysis separately from top-level parsing.
+  void ParseDeferredObjCMethodBodies();
+
   DeclGroupPtrTy ParseObjCAtImplementationDeclaration(SourceLocation AtLoc);
   DeclGroupPtrTy ParseObjCAtEndDeclaration(SourceRange atEnd);
   Decl *ParseObjCAtAliasDeclaration(SourceLocation atLoc);
@@ -1932,6 +1988,52 @@ private:
   isCXXDeclarationSpecifier(TPResult BracedCastResult = TPResult::False(),
                             bool *HasMissingTypename = 0);
 
+  /// \brief A memoized result of isCXXDeclarationSpecifier.
+  struct DeclSpecifierClassification {
+    TPResult Result;
+    bool HasMissingTypename;
+    DeclSpecifierClassification(TPResult Result, bool HasMissingTypename)
+      : Result(Result), HasMissingTypename(HasMissingTypename) {}
+  };
+
+  /// \brief Results of isCXXDeclarationSpecifier computed during the current
+  /// outermost tentative parse.
+  ///
+  /// Nested disambiguation, common in Objective-C++ blocks and deeply nested
+  /// template arguments, asks the same question of the same token many
+  /// times, and each answer may involve name lookup in Sema. The key, built
+  /// by getDeclSpecifierCacheKey, packs the token's raw location, the
+  /// BracedCastResult, the number of tentatively-declared identifiers and
+  /// whether the caller passed HasMissingTypename, since those are all the
+  /// answer depends on while no declarations are being committed: without
+  /// HasMissingTypename, a missing 'typename' yields False rather than
+  /// Ambiguous. The cache is cleared when the outermost
+  /// TentativeParsingAction finishes.
+  llvm::DenseMap<uint64_t, DeclSpecifierClassification> DeclSpecifierCache;
+
+  /// \brief The DeclSpecifierCache key of a call to isCXXDeclarationSpecifier
+  /// at \p Loc.
+  uint64_t getDeclSpecifierCacheKey(SourceLocation Loc,
+                                    TPResult BracedCastResult,
+                                    bool WantsMissingTypename) const {
+    uint64_t Braced = BracedCastResult == TPResult::True() ? 0 :
+                      BracedCastResult == TPResult::False() ? 1 :
+                      BracedCastResult == TPResult::Ambiguous() ? 2 : 3;
+    return uint64_t(Loc.getRawEncoding()) << 32 |
+           uint64_t(TentativelyDeclaredIdentifiers.size()) << 3 |
+           Braced << 1 | uint64_t(WantsMissingTypename);
+  }
+
+  /// \brief Number of isCXXDeclarationSpecifier calls answered from
+  /// DeclSpecifierCache.
+  unsigned NumDeclSpecifierCacheHits;
+
+  void LeaveTentativeParse() {
+    assert(TentativeParsingDepth && "not in a tentative parse");
+    if (--TentativeParsingDepth == 0)
+      DeclSpecifierCache.clear();
+  }
+
   /// Given that isCXXDeclarationSpecifier returns \c TPResult::True or
   /// \c TPResult::Ambiguous, determine whether the decl-specifier would be
   /// a type-specifier other than a cv-qualifier.
@@ -18,6 +18,7 @@
 #include "clang/Basic/SourceLocation.h"
 #include "clang/Rewrite/Core/DeltaTree.h"
 #include "clang/Rewrite/Core/RewriteRope.h"
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/StringRef.h"
 #include <cstring>
 #include <map>
@@ -89,6 +90,26 @@ public:
   void ReplaceText(unsigned OrigOffset, unsigned OrigLength,
                    StringRef NewStr);
 
+  /// Edit - One replacement for ApplyEdits, in offsets of the original
+  /// buffer. An OrigLength of 0 is an insertion.
+  struct Edit {
+    unsigned OrigOffset;
+    unsigned OrigLength;
+    StringRef NewText;
+
+    Edit(unsigned OrigOffset, unsigned OrigLength, StringRef NewText)
+      : OrigOffset(OrigOffset), OrigLength(OrigLength), NewText(NewText) {}
+  };
+
+  /// ApplyEdits - Apply a batch of edits at once. They are sorted by offset,
+  /// keeping insertions at the same offset in their given order, and the
+  /// new rope and delta tree are built in one pass over the current text,
+  /// instead of one tree update per edit as ReplaceText does. This is the
+  /// way to apply the tens of thousands of edits a migration produces.
+  ///
+  /// Returns true, and changes nothing, if two edits overlap.
+  bool ApplyEdits(ArrayRef<Edit> Edits);
+
 private:  // Methods only usable by Rewriter.
 
   /// Initialize - Start this rewrite buffer out with a copy of the unmodified
@@ -181,6 +202,12 @@ public:
   ///
   std::string getRewrittenText(SourceRange Range) const;
 
+  /// writeRewrittenText - Write the rewritten form of the text in \p Range to
+  /// \p OS straight from the rope, without building a string of it. Returns
+  /// true, writing nothing, in the cases getRewrittenText returns an empty
+  /// string.
+  bool writeRewrittenText(SourceRange Range, raw_ostream &OS) const;
+
   /// InsertText - Insert the specified string at the specified location in the
   /// original buffer.  This method returns true (and does nothing) if the input
   /// location was not rewritable, false otherwise.
@@ -286,6 +313,11 @@ public:
 
   /// overwriteChangedFiles - Save all changed files to disk.
   ///
+  /// Each file is written from the chunks of its rope to a temporary file
+  /// next to it, which is then renamed over the original, so the rewritten
+  /// text is never copied into one contiguous buffer and a failed write
+  /// leaves the original intact.
+  ///
   /// Returns true if any files were not saved successfully.
   /// Outputs diagnostics via the source manager's diagnostic engine
   /// in case of an error.
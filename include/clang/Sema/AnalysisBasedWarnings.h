@@ -15,10 +15,12 @@
 #define LLVM_CLANG_SEMA_ANALYSIS_WARNINGS_H
 
 #include "llvm/ADT/DenseMap.h"
+#include <vector>
 
 namespace clang {
 
 class BlockExpr;
+class CFGCache;
 class Decl;
 class FunctionDecl;
 class ObjCMethodDecl;
@@ -51,6 +53,23 @@ private:
   enum VisitFlag { NotVisited = 0, Visited = 1, Pending = 2 };
   llvm::DenseMap<const FunctionDecl*, VisitFlag> VisitedFD;
 
+  /// \brief A function body whose thread safety or consumed analysis was
+  /// postponed until the end of the translation unit.
+  struct DeferredFlowAnalysis {
+    const Decl *D;
+    unsigned RunThreadSafety : 1;
+    unsigned RunConsumed : 1;
+  };
+  std::vector<DeferredFlowAnalysis> DeferredFlowAnalyses;
+
+  /// \brief Number of worker threads for the deferred analyses, or 0 to run
+  /// them as each function body is completed.
+  unsigned NumFlowAnalysisThreads;
+
+  /// \brief Where to keep the CFGs built for these warnings so the static
+  /// analyzer can reuse them, if anywhere. Not owned.
+  CFGCache *SharedCFGs;
+
   /// \name Statistics
   /// @{
 
@@ -95,6 +114,36 @@ public:
 
   Policy getDefaultPolicy() { return DefaultPolicy; }
 
+  /// \brief Postpone the -Wthread-safety and -Wconsumed analyses to
+  /// RunDeferredFlowAnalyses, which runs them on \p NumThreads threads.
+  /// Only set by -analysis-warnings-threads, since it changes where their
+  /// diagnostics appear in the output.
+  void setFlowAnalysisThreads(unsigned NumThreads) {
+    NumFlowAnalysisThreads = NumThreads;
+  }
+
+  /// \brief Build CFGs through \p Cache, so that later clients such as the
+  /// static analyzer can share them. Without a cache, which is the default
+  /// and the case unless the analyzer runs, each CFG is freed once the
+  /// function's warnings are issued.
+  void setSharedCFGCache(CFGCache *Cache) { SharedCFGs = Cache; }
+
+  /// \brief Run every postponed thread safety and consumed analysis.
+  ///
+  /// CFGs are built on the calling thread, since building one may query
+  /// Sema and the ASTContext. The analyses then run on a pool of workers,
+  /// each collecting its diagnostics instead of emitting them. Once all
+  /// workers finish, the diagnostics are emitted on the calling thread one
+  /// function at a time, in the order the functions were deferred and, per
+  /// function, in the order the analysis produced them.
+  ///
+  /// The output does not match a serial run: these warnings now follow
+  /// every other diagnostic of the translation unit, and since they are
+  /// emitted last, -ferror-limit may cut them off where a serial run would
+  /// have cut off later diagnostics instead. Called from
+  /// Sema::ActOnEndOfTranslationUnit.
+  void RunDeferredFlowAnalyses();
+
   void PrintStats() const;
 };
 
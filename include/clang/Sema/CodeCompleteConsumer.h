@@ -140,6 +140,17 @@ unsigned getMacroUsagePriority(StringRef MacroName,
 /// declaration.
 CXCursorKind getCursorKindForDecl(const Decl *D);
 
+/// \brief Score how well \p Candidate, the typed text of a completion, matches
+/// \p Filter, the text the user has typed so far.
+///
+/// The characters of \p Filter must appear in \p Candidate in order,
+/// compared case-insensitively; otherwise the result is 0. Matches at the
+/// start of the candidate, of a camel-case hump, after an underscore or of an
+/// Objective-C selector piece, and runs of consecutive matches, score higher,
+/// so "initWF" ranks initWithFrame: above initWithDefaultFrame:. An empty
+/// filter matches everything with score 1.
+unsigned getFuzzyMatchScore(StringRef Filter, StringRef Candidate);
+
 class FunctionDecl;
 class FunctionType;
 class FunctionTemplateDecl;
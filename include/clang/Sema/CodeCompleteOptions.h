@@ -25,11 +25,16 @@ public:
   /// Show brief documentation comments in code completion results.
   unsigned IncludeBriefComments : 1;
 
+  /// If nonzero, only the best MaxResults results matching the filter, by
+  /// fuzzy match score and then priority, are produced.
+  unsigned MaxResults;
+
   CodeCompleteOptions() :
       IncludeMacros(0),
       IncludeCodePatterns(0),
       IncludeGlobals(1),
-      IncludeBriefComments(0)
+      IncludeBriefComments(0),
+      MaxResults(0)
   { }
 };
 
@@ -29,6 +29,7 @@ class LookupResult;
 struct ObjCMethodList;
 class Scope;
 class Sema;
+class TemplateArgumentList;
 class TypedefNameDecl;
 class ValueDecl;
 class VarDecl;
@@ -189,6 +190,21 @@ public:
   virtual void ReadLateParsedTemplates(
       llvm::DenseMap<const FunctionDecl *, LateParsedTemplate *> &LPTMap) {}
 
+  /// \brief Find a definition of \p Pattern instantiated with \p Args that
+  /// the external source has already built.
+  ///
+  /// \param ArgsHash The value of Sema::hashTemplateArguments for \p Args,
+  /// which the external source uses as its lookup key. Candidates are
+  /// compared against \p Args in full before being returned.
+  ///
+  /// \returns the instantiated definition, or null if there is none.
+  virtual FunctionDecl *
+  FindInstantiatedDefinition(const FunctionDecl *Pattern,
+                             const TemplateArgumentList &Args,
+                             unsigned ArgsHash) {
+    return 0;
+  }
+
   /// \copydoc Sema::CorrectTypo
   /// \note LookupKind must correspond to a valid Sema::LookupNameKind
   ///
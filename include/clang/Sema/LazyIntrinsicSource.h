@@ -0,0 +1,81 @@
+//===--- LazyIntrinsicSource.h - On-demand intrinsic wrappers ---*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+//  This file defines LazyIntrinsicSource, an ExternalSemaSource that declares
+//  the inline wrapper functions of the compiler's intrinsic headers only when
+//  their names are first looked up.
+//
+//===----------------------------------------------------------------------===//
+#ifndef LLVM_CLANG_SEMA_LAZY_INTRINSIC_SOURCE_H
+#define LLVM_CLANG_SEMA_LAZY_INTRINSIC_SOURCE_H
+
+#include "clang/Basic/SourceLocation.h"
+#include "clang/Sema/ExternalSemaSource.h"
+#include "llvm/ADT/StringMap.h"
+
+namespace clang {
+
+  class FileEntry;
+  class LookupResult;
+  class Preprocessor;
+  class Scope;
+  class Sema;
+
+/// \brief Declares intrinsic wrappers such as those of arm_neon.h and
+/// immintrin.h on first unqualified lookup (-flazy-intrinsic-headers).
+///
+/// When the preprocessor enters one of the headers of the
+/// _Builtin_intrinsics module, the wrapper function definitions at file
+/// scope are not handed to the parser. Instead a raw lexer pass records
+/// the source range of each one under its name. Types, macros and any
+/// other declarations are parsed as usual. A wrapper is kept only if the
+/// target supports the __builtin_* functions it calls, according to the
+/// Builtins*.def tables, so looking up an unavailable intrinsic fails the
+/// same way as with the textual header.
+///
+/// The first time a recorded name is looked up, its tokens are parsed at
+/// file scope and the resulting FunctionDecl is added to the lookup result.
+/// Wrappers a translation unit never names are never parsed.
+class LazyIntrinsicSource : public ExternalSemaSource {
+  /// \brief Where the definition of a wrapper was found.
+  struct Entry {
+    SourceLocation Begin, End;
+    bool Declared;
+  };
+
+  Preprocessor &PP;
+  Sema *SemaPtr;
+  llvm::StringMap<Entry> Wrappers;
+
+  unsigned NumIndexed, NumDeclared;
+
+public:
+  explicit LazyIntrinsicSource(Preprocessor &PP);
+  ~LazyIntrinsicSource();
+
+  /// \brief Whether \p File is an intrinsic header handled lazily.
+  static bool isLazyHeader(const FileEntry *File);
+
+  /// \brief Record the wrapper definition named \p Name, spanning
+  /// [\p Begin, \p End], instead of parsing it.
+  void addWrapper(StringRef Name, SourceLocation Begin, SourceLocation End);
+
+  void InitializeSema(Sema &S) override { SemaPtr = &S; }
+  void ForgetSema() override { SemaPtr = nullptr; }
+
+  /// \brief Parse and declare the wrapper named by \p R, if there is one
+  /// and it was not declared yet.
+  bool LookupUnqualified(LookupResult &R, Scope *S) override;
+
+  void PrintStats() override;
+};
+
+} // end namespace clang
+
+#endif
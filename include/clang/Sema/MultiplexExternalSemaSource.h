@@ -335,6 +335,12 @@ public:
                          llvm::DenseMap<const FunctionDecl *,
                                         LateParsedTemplate *> &LPTMap) override;
 
+  /// \copydoc ExternalSemaSource::FindInstantiatedDefinition
+  /// \note Returns the first definition found.
+  FunctionDecl *FindInstantiatedDefinition(const FunctionDecl *Pattern,
+                                           const TemplateArgumentList &Args,
+                                           unsigned ArgsHash) override;
+
   /// \copydoc ExternalSemaSource::CorrectTypo
   /// \note Returns the first nonempty correction.
   TypoCorrection CorrectTypo(const DeclarationNameInfo &Typo,
@@ -21,6 +21,10 @@ namespace clang {
 class ObjCMethodDecl;
 
 /// ObjCMethodList - a linked list of methods with different signatures.
+///
+/// This is the canonical, serializable form of the global method pool. Sema
+/// keeps flattened copies of these lists for fast lookup (see
+/// Sema::FlatMethodList).
 struct ObjCMethodList {
   ObjCMethodDecl *Method;
   /// \brief The next list object and 2 bits for extra info.
@@ -873,6 +873,43 @@ public:
   /// methods inside categories with a particular selector.
   GlobalMethodPool MethodPool;
 
+  /// \brief A flattened view of one list in a GlobalMethods entry.
+  ///
+  /// Common selectors such as \c init accumulate hundreds of methods from
+  /// the SDK. Message sends consult this array, which stores a hash of each
+  /// method's signature next to the method, rather than walking and comparing
+  /// every element of the linked ObjCMethodList.
+  struct FlatMethodList {
+    SmallVector<ObjCMethodDecl *, 4> Methods;
+    SmallVector<unsigned, 4> SignatureHashes;
+
+    /// \brief Whether every method in the list has the same signature hash,
+    /// in which case a lookup can return the first method without checking
+    /// for conflicting signatures.
+    bool AllSignaturesMatch;
+
+    FlatMethodList() : AllSignaturesMatch(true) {}
+  };
+  typedef std::pair<FlatMethodList, FlatMethodList> FlatGlobalMethods;
+
+  /// \brief Flattened method lists, built on demand from MethodPool.
+  ///
+  /// An entry is dropped whenever a method is added to the corresponding
+  /// MethodPool entry, either by Sema or by the external source.
+  llvm::DenseMap<Selector, FlatGlobalMethods> FlatMethodPool;
+
+  /// \brief Retrieve the flattened instance or factory method list for
+  /// \p Sel, building it from MethodPool if needed.
+  const FlatMethodList &getFlatMethodList(Selector Sel, bool Instance);
+
+  /// \brief Compute a hash of the parts of \p Method that
+  /// MatchTwoMethodDeclarations compares: the result type, the parameter
+  /// types, variadicity and the relevant attributes.
+  ///
+  /// Methods with different hashes never match; methods with equal hashes
+  /// are still compared in full when a mismatch must be diagnosed.
+  static unsigned computeMethodSignatureHash(const ObjCMethodDecl *Method);
+
   /// Method selectors used in a \@selector expression. Used for implementation
   /// of -Wselector.
   llvm::DenseMap<Selector, SourceLocation> ReferencedSelectors;
@@ -2826,6 +2863,9 @@ private:
 
   /// LookupMethodInGlobalPool - Returns the instance or factory method and
   /// optionally warns if there are multiple signatures.
+  ///
+  /// Uses the FlatMethodPool, so a selector whose methods all share one
+  /// signature is answered without visiting the rest of the list.
   ObjCMethodDecl *LookupMethodInGlobalPool(Selector Sel, SourceRange R,
                                            bool receiverIdOrClass,
                                            bool warn, bool instance);
@@ -6652,10 +6692,20 @@ public:
 
   void InstantiateExceptionSpec(SourceLocation PointOfInstantiation,
                                 FunctionDecl *Function);
+  /// \brief Instantiate the definition of the given function from its
+  /// template.
+  ///
+  /// If the external source (for instance a module or PCH) already contains
+  /// a definition instantiated from the same pattern with the same template
+  /// arguments, that definition is reused instead of being rebuilt.
   void InstantiateFunctionDefinition(SourceLocation PointOfInstantiation,
                                      FunctionDecl *Function,
                                      bool Recursive = false,
                                      bool DefinitionRequired = false);
+
+  /// \brief Compute a hash of \p Args that is stable across translation
+  /// units, for use as a key in the table of instantiated definitions.
+  static unsigned hashTemplateArguments(const TemplateArgumentList &Args);
   VarTemplateSpecializationDecl *BuildVarTemplateInstantiation(
       VarTemplateDecl *VarTemplate, VarDecl *FromVar,
       const TemplateArgumentList &TemplateArgList,
@@ -542,7 +542,12 @@ namespace clang {
       UNDEFINED_BUT_USED = 49,
 
       /// \brief Record code for late parsed template functions.
-      LATE_PARSED_TEMPLATE = 50
+      LATE_PARSED_TEMPLATE = 50,
+
+      /// \brief Record code for the table of implicitly instantiated
+      /// function definitions, keyed by the pattern they were instantiated
+      /// from and a hash of their template arguments.
+      INSTANTIATED_DEFINITIONS = 51
     };
 
     /// \brief Record types used within a source manager block.
@@ -29,6 +29,7 @@
 #include "clang/Sema/ExternalSemaSource.h"
 #include "clang/Serialization/ASTBitCodes.h"
 #include "clang/Serialization/ContinuousRangeMap.h"
+#include "clang/Serialization/DeserializationTracker.h"
 #include "clang/Serialization/Module.h"
 #include "clang/Serialization/ModuleManager.h"
 #include "llvm/ADT/APFloat.h"
@@ -772,6 +773,17 @@ private:
   // \brief A list of late parsed template function data.
   SmallVector<uint64_t, 1> LateParsedTemplates;
 
+  /// \brief The instantiated function definitions available from the loaded
+  /// AST files, keyed by the global ID of the pattern and the hash of the
+  /// template arguments.
+  ///
+  /// Several entries may share a key when their argument hashes collide.
+  std::multimap<std::pair<serialization::DeclID, unsigned>,
+                serialization::DeclID> InstantiatedDefinitions;
+
+  /// \brief Number of instantiated definitions reused from AST files.
+  unsigned NumInstantiatedDefinitionsReused;
+
   struct ImportedSubmodule {
     serialization::SubmoduleID ID;
     SourceLocation ImportLoc;
@@ -877,6 +889,11 @@ private:
   /// \brief The total number of method pool entries in the selector table.
   unsigned TotalNumMethodPoolEntries;
 
+  /// \brief The number of module method pool tables that a method pool
+  /// lookup did not have to probe, because the global module index showed
+  /// they have no methods for the selector.
+  unsigned NumMethodPoolTablesSkipped;
+
   /// Number of lexical decl contexts read/total.
   unsigned NumLexicalDeclContextsRead, TotalLexicalDeclContexts;
 
@@ -1030,6 +1047,37 @@ private:
     ~ReadingKindTracker() { Reader.ReadingKind = PrevKind; }
   };
 
+  /// \brief Why the entities currently being deserialized were requested,
+  /// as reported to a DeserializationTracker.
+  serialization::DeserializationReason CurrentDeserializationReason;
+
+  /// \brief RAII object to record why deserialization was triggered.
+  ///
+  /// Only the outermost reason is kept: an entity loaded while deserializing
+  /// another one is attributed to DR_Reference rather than to whatever caused
+  /// the outer load.
+  class DeserializationReasonRAII {
+    ASTReader &Reader;
+    serialization::DeserializationReason PrevReason;
+
+    DeserializationReasonRAII(const DeserializationReasonRAII &)
+      LLVM_DELETED_FUNCTION;
+    void operator=(const DeserializationReasonRAII &) LLVM_DELETED_FUNCTION;
+
+  public:
+    DeserializationReasonRAII(ASTReader &Reader,
+                              serialization::DeserializationReason Reason)
+      : Reader(Reader), PrevReason(Reader.CurrentDeserializationReason) {
+      Reader.CurrentDeserializationReason =
+          Reader.NumCurrentElementsDeserializing ? serialization::DR_Reference
+                                                 : Reason;
+    }
+
+    ~DeserializationReasonRAII() {
+      Reader.CurrentDeserializationReason = PrevReason;
+    }
+  };
+
   /// \brief Suggested contents of the predefines buffer, after this
   /// PCH file has been processed.
   ///
@@ -1362,6 +1410,12 @@ public:
   /// \brief Set the AST deserialization listener.
   void setDeserializationListener(ASTDeserializationListener *Listener);
 
+  /// \brief Why the declaration or type currently being deserialized was
+  /// requested.
+  serialization::DeserializationReason getCurrentDeserializationReason() const {
+    return CurrentDeserializationReason;
+  }
+
   /// \brief Determine whether this AST reader has a global index.
   bool hasGlobalIndex() const { return (bool)GlobalIndex; }
 
@@ -1705,6 +1759,10 @@ public:
 
   /// \brief Load the contents of the global method pool for a given
   /// selector.
+  ///
+  /// The method pool tables stay on disk until a selector is queried. When
+  /// a global module index is available, only the module files it lists for
+  /// \p Sel are probed.
   void ReadMethodPool(Selector Sel) override;
 
   /// \brief Load the set of namespaces that are known to the external source,
@@ -1747,6 +1805,10 @@ public:
                          llvm::DenseMap<const FunctionDecl *,
                                         LateParsedTemplate *> &LPTMap) override;
 
+  FunctionDecl *FindInstantiatedDefinition(const FunctionDecl *Pattern,
+                                           const TemplateArgumentList &Args,
+                                           unsigned ArgsHash) override;
+
   /// \brief Load a selector from disk, registering its ID if it exists.
   void LoadSelector(Selector Sel);
 
@@ -154,6 +154,40 @@ private:
   /// \brief The declarations and types to emit.
   std::queue<DeclOrType> DeclTypesToEmit;
 
+  /// \brief A record of the DECLTYPES block that has been built but not yet
+  /// encoded into the bitstream.
+  struct PendingRecord {
+    unsigned Code;
+    unsigned Abbrev;
+    RecordData Record;
+    /// \brief Which offset table, if any, receives this record's bit offset
+    /// relative to the start of the block.
+    enum { OK_None, OK_Decl, OK_Type } OffsetKind;
+    /// \brief The index in DeclOffsets or TypeOffsets to fill in.
+    unsigned OffsetIndex;
+  };
+
+  /// \brief Records of the DECLTYPES block waiting to be encoded, in the
+  /// order they must appear.
+  ///
+  /// Building a record resolves references to other declarations and types
+  /// and so must happen in order on one thread; encoding the finished
+  /// records into bits does not. When NumEncodingThreads is more than one,
+  /// WriteDecl and WriteType append here instead of emitting directly.
+  std::vector<PendingRecord> PendingDeclTypeRecords;
+
+  /// \brief The number of threads used to encode the DECLTYPES block.
+  unsigned NumEncodingThreads;
+
+  /// \brief Encode PendingDeclTypeRecords into the stream.
+  ///
+  /// The records are split into contiguous chunks, and each chunk is
+  /// encoded on its own thread into a separate bit buffer that uses the
+  /// block's abbreviations. The buffers are then appended to the stream at
+  /// the current bit position, and each chunk's offsets are shifted by the
+  /// position at which the chunk landed.
+  void EncodePendingDeclTypeRecords();
+
   /// \brief The first ID number we can use for our own declarations.
   serialization::DeclID FirstDeclID;
 
@@ -488,6 +522,7 @@ private:
   void WriteRedeclarations();
   void WriteMergedDecls();
   void WriteLateParsedTemplates(Sema &SemaRef);
+  void WriteInstantiatedDefinitions(Sema &SemaRef);
 
   unsigned DeclParmVarAbbrev;
   unsigned DeclContextLexicalAbbrev;
@@ -517,6 +552,11 @@ public:
   ASTWriter(llvm::BitstreamWriter &Stream);
   ~ASTWriter();
 
+  /// \brief Encode declaration and type records on \p N threads. The output
+  /// is bit-for-bit identical to a single-threaded write.
+  void setNumEncodingThreads(unsigned N) { NumEncodingThreads = N; }
+  unsigned getNumEncodingThreads() const { return NumEncodingThreads; }
+
   /// \brief Write a precompiled header for the given semantic analysis.
   ///
   /// \param SemaRef a reference to the semantic analysis object that processed
@@ -798,6 +838,10 @@ protected:
   const ASTWriter &getWriter() const { return Writer; }
 
 public:
+  /// \param Out The stream to write to. If null, the AST file is written
+  /// directly to \p OutputFile through an llvm::FileOutputBuffer, and the
+  /// in-memory bitstream is released as it is copied, so that peak memory
+  /// does not hold two copies of the file.
   PCHGenerator(const Preprocessor &PP, StringRef OutputFile,
                clang::Module *Module,
                StringRef isysroot, raw_ostream *Out,
@@ -0,0 +1,100 @@
+//===--- DeserializationTracker.h - Why AST entities were loaded *- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+//  This file defines the DeserializationTracker class, which records which
+//  declarations and types were deserialized from each AST file and what
+//  triggered each load.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_SERIALIZATION_DESERIALIZATIONTRACKER_H
+#define LLVM_CLANG_SERIALIZATION_DESERIALIZATIONTRACKER_H
+
+#include "clang/Basic/LLVM.h"
+#include "clang/Serialization/ASTDeserializationListener.h"
+#include "llvm/ADT/DenseMap.h"
+
+namespace llvm {
+class raw_ostream;
+}
+
+namespace clang {
+
+class ASTReader;
+
+namespace serialization {
+class ModuleFile;
+
+/// \brief What caused the ASTReader to deserialize an entity.
+enum DeserializationReason {
+  /// \brief Named in the file's list of eagerly deserialized declarations,
+  /// or otherwise loaded when the file was loaded.
+  DR_Eager,
+  /// \brief Found by name lookup into a declaration context.
+  DR_NameLookup,
+  /// \brief Loaded while completing a redeclaration chain.
+  DR_Redeclarations,
+  /// \brief Loaded by an update record for a visible declaration context.
+  DR_VisibleUpdate,
+  /// \brief Loaded while deserializing another declaration or type that
+  /// refers to it.
+  DR_Reference,
+  /// \brief Anything else, such as a lexical walk of a declaration context.
+  DR_Other,
+  NUM_DESERIALIZATION_REASONS
+};
+} // end namespace serialization
+
+/// \brief An ASTDeserializationListener that attributes each deserialized
+/// declaration and type to the AST file that contained it and to the reason
+/// the ASTReader gave for loading it.
+///
+/// The report groups counts by module file. A module whose entities are
+/// mostly DR_Eager loads is being force-loaded when it is imported, and is
+/// the first place to look when tuning imports.
+class DeserializationTracker : public ASTDeserializationListener {
+  struct Counts {
+    unsigned Decls[serialization::NUM_DESERIALIZATION_REASONS];
+    unsigned Types[serialization::NUM_DESERIALIZATION_REASONS];
+    Counts() {
+      for (unsigned I = 0; I != serialization::NUM_DESERIALIZATION_REASONS;
+           ++I)
+        Decls[I] = Types[I] = 0;
+    }
+  };
+
+  ASTReader *Reader;
+  ASTDeserializationListener *Previous;
+  llvm::DenseMap<serialization::ModuleFile *, Counts> PerModule;
+
+public:
+  /// \brief Create a tracker that forwards every notification to
+  /// \p Previous, if given.
+  explicit DeserializationTracker(ASTDeserializationListener *Previous = 0)
+    : Reader(0), Previous(Previous) {}
+  ~DeserializationTracker();
+
+  void ReaderInitialized(ASTReader *Reader) override;
+  void IdentifierRead(serialization::IdentID ID, IdentifierInfo *II) override;
+  void MacroRead(serialization::MacroID ID, MacroInfo *MI) override;
+  void TypeRead(serialization::TypeIdx Idx, QualType T) override;
+  void DeclRead(serialization::DeclID ID, const Decl *D) override;
+  void SelectorRead(serialization::SelectorID ID, Selector Sel) override;
+  void MacroDefinitionRead(serialization::PreprocessedEntityID ID,
+                           MacroDefinition *MD) override;
+  void ModuleRead(serialization::SubmoduleID ID, Module *Mod) override;
+
+  /// \brief Print the per-module report, sorted by the number of
+  /// declarations loaded.
+  void print(raw_ostream &OS) const;
+};
+
+} // end namespace clang
+
+#endif
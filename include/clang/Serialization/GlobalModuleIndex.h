@@ -68,6 +68,13 @@ class GlobalModuleIndex {
   /// GlobalModuleIndex.
   void *IdentifierIndex;
 
+  /// \brief The hash table mapping Objective-C selectors to the module files
+  /// whose method pool has entries for them.
+  ///
+  /// This pointer actually points to a SelectorIndexTable object, which is
+  /// only accessible within the implementation of GlobalModuleIndex.
+  void *SelectorIndex;
+
   /// \brief Information about a given module file.
   struct ModuleInfo {
     ModuleInfo() : File(), Size(), ModTime() { }
@@ -113,6 +120,12 @@ class GlobalModuleIndex {
   /// \brief The number of identifier lookup hits, where we recognize the
   /// identifier.
   unsigned NumIdentifierLookupHits;
+
+  /// \brief The number of selector lookups we performed.
+  unsigned NumSelectorLookups;
+
+  /// \brief The number of selector lookup hits.
+  unsigned NumSelectorLookupHits;
   
   /// \brief Internal constructor. Use \c readIndex() to read an index.
   explicit GlobalModuleIndex(llvm::MemoryBuffer *Buffer,
@@ -177,6 +190,17 @@ public:
   /// \returns true if the identifier is known to the index, false otherwise.
   bool lookupIdentifier(StringRef Name, HitSet &Hits);
 
+  /// \brief Look for all of the module files whose global method pool has
+  /// methods for the given selector.
+  ///
+  /// \param Name The selector, spelled as by \c Selector::getAsString().
+  ///
+  /// \param Hits Will be populated with the set of module files that have
+  /// methods with this selector.
+  ///
+  /// \returns true if the selector is known to the index, false otherwise.
+  bool lookupSelector(StringRef Name, HitSet &Hits);
+
   /// \brief Note that the given module file has been loaded.
   ///
   /// \returns false if the global module index has information about this
@@ -196,6 +220,29 @@ public:
   /// \param Path The path to the directory containing module files, into
   /// which the global index will be written.
   static ErrorCode writeIndex(FileManager &FileMgr, StringRef Path);
+
+  /// \brief Update the global index in the given directory with the module
+  /// files that were added or changed since it was written.
+  ///
+  /// Module files whose size and modification time still match the existing
+  /// index keep their identifier entries, which are copied from the old
+  /// index without reloading the module file; only new or changed module
+  /// files are read. Entries for module files that no longer exist are
+  /// dropped. If there is no existing index, this is equivalent to
+  /// \c writeIndex().
+  ///
+  /// The result is written to a new, versioned index file which is then
+  /// atomically renamed over the previous one, so readers never need to take
+  /// the index lock and always see a complete index.
+  static ErrorCode updateIndex(FileManager &FileMgr, StringRef Path);
+
+  /// \brief Retrieve the version of the index that was read, which is
+  /// incremented each time the index is written or updated.
+  unsigned getIndexVersion() const { return IndexVersion; }
+
+private:
+  /// \brief The version of the index, from the index file's metadata.
+  unsigned IndexVersion;
 };
 
 }
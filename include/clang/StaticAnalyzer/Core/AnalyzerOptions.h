@@ -117,6 +117,26 @@ enum IPAKind {
   IPAK_DynamicDispatchBifurcate = 5
 };
 
+/// \brief Describes the order in which the path-sensitive engine explores
+/// the exploded graph.
+enum ExplorationStrategyKind {
+  ESK_NotSet = 0,
+
+  /// Explore the most recently queued node first.
+  ESK_DFS = 1,
+
+  /// Explore nodes in the order they were queued.
+  ESK_BFS = 2,
+
+  /// Explore blocks breadth-first and the contents of each block
+  /// depth-first.
+  ESK_BFSBlockDFSContents = 3,
+
+  /// Prefer nodes in CFG blocks, and calls to functions, that have not been
+  /// explored yet, falling back to depth-first order among equals.
+  ESK_UnexploredFirst = 4
+};
+
 class AnalyzerOptions : public RefCountedBase<AnalyzerOptions> {
 public:
   typedef llvm::StringMap<std::string> ConfigTable;
@@ -132,6 +152,10 @@ public:
   AnalysisPurgeMode AnalysisPurgeOpt;
   
   std::string AnalyzeSpecificFunction;
+
+  /// \brief Directory in which to reuse and store the results of analyzing
+  /// whole translation units; empty to disable the cache.
+  std::string ResultsCacheDir;
   
   /// \brief The maximum number of times the analyzer visits a block.
   unsigned maxBlockVisitOnPath;
@@ -218,6 +242,12 @@ private:
   /// \sa shouldSuppressNullReturnPaths
   Optional<bool> SuppressNullReturnPaths;
 
+  /// \sa shouldUseCallSummaries
+  Optional<bool> UseCallSummaries;
+
+  /// \sa shouldProfileCheckers
+  Optional<bool> ProfileCheckers;
+
   // \sa getMaxInlinableSize
   Optional<unsigned> MaxInlinableSize;
 
@@ -242,6 +272,12 @@ private:
   /// \sa getMaxNodesPerTopLevelFunction
   Optional<unsigned> MaxNodesPerTopLevelFunction;
 
+  /// \sa getAnalysisThreads
+  Optional<unsigned> AnalysisThreads;
+
+  /// \sa getExplorationStrategy
+  ExplorationStrategyKind ExplorationStrategy;
+
 public:
   /// Interprets an option's string value as a boolean.
   ///
@@ -386,6 +422,22 @@ public:
   /// for well-known functions.
   bool shouldSynthesizeBodies();
 
+  /// Returns whether the engine should reuse the outcome of inlining a
+  /// side-effect-free callee for later calls with the same arguments,
+  /// instead of inlining it again.
+  ///
+  /// This is controlled by the 'ipa-call-summaries' config option, which
+  /// accepts the values "true" and "false". The default is "false".
+  bool shouldUseCallSummaries();
+
+  /// Returns whether CheckerManager should record the time spent and the
+  /// exploded nodes generated by each checker, per callback kind.
+  ///
+  /// This is controlled by the 'profile-checkers' config option, which
+  /// accepts the values "true" and "false". Results are printed with
+  /// -analyzer-stats and, for timings, -ftime-report.
+  bool shouldProfileCheckers();
+
   /// Returns how often nodes in the ExplodedGraph should be recycled to save
   /// memory.
   ///
@@ -405,6 +457,23 @@ public:
   /// This is controlled by the 'max-nodes' config option.
   unsigned getMaxNodesPerTopLevelFunction();
 
+  /// Returns the number of threads used to analyze independent roots of the
+  /// call graph. Each thread runs its own ExprEngine over a disjoint set of
+  /// top-level functions; path diagnostics are merged and deduplicated by
+  /// the PathDiagnosticConsumers, which sort them before output so the
+  /// result does not depend on scheduling.
+  /// 1 is default; 0 means one per hardware thread.
+  ///
+  /// This is controlled by the 'analysis-threads' config option.
+  unsigned getAnalysisThreads();
+
+  /// Returns the order in which the engine explores each exploded graph.
+  ///
+  /// This is controlled by the 'exploration-strategy' config option, which
+  /// accepts the values "dfs", "bfs", "bfs_block_dfs_contents" and
+  /// "unexplored_first". The default is "dfs".
+  ExplorationStrategyKind getExplorationStrategy();
+
 public:
   AnalyzerOptions() :
     AnalysisStoreOpt(RegionStoreModel),
@@ -427,7 +496,8 @@ public:
     InliningMode(NoRedundancy),
     UserMode(UMK_NotSet),
     IPAMode(IPAK_NotSet),
-    CXXMemberInliningMode() {}
+    CXXMemberInliningMode(),
+    ExplorationStrategy(ESK_NotSet) {}
 
 };
   
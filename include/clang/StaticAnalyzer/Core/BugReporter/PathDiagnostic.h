@@ -20,6 +20,7 @@
 #include "llvm/ADT/IntrusiveRefCntPtr.h"
 #include "llvm/ADT/Optional.h"
 #include "llvm/ADT/PointerUnion.h"
+#include "llvm/Support/Mutex.h"
 #include <deque>
 #include <iterator>
 #include <list>
@@ -93,6 +94,12 @@ public:
 
   virtual StringRef getName() const = 0;
   
+  /// \brief Take ownership of \p D, folding it into an equivalent diagnostic
+  /// already received if there is one.
+  ///
+  /// This may be called concurrently by analyses running on different
+  /// threads; FlushDiagnostics sorts what was received, so the output order
+  /// does not depend on the order of the calls.
   void HandlePathDiagnostic(PathDiagnostic *D);
 
   enum PathGenerationScheme { None, Minimal, Extensive, AlternateExtensive };
@@ -106,6 +113,9 @@ public:
 protected:
   bool flushed;
   llvm::FoldingSet<PathDiagnostic> Diags;
+
+  /// \brief Guards Diags against concurrent HandlePathDiagnostic calls.
+  llvm::sys::Mutex DiagsLock;
 };
 
 //===----------------------------------------------------------------------===//
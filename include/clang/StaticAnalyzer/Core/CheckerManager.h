@@ -14,12 +14,16 @@
 #ifndef LLVM_CLANG_SA_CORE_CHECKERMANAGER_H
 #define LLVM_CLANG_SA_CORE_CHECKERMANAGER_H
 
+#include "clang/AST/Stmt.h"
 #include "clang/Analysis/ProgramPoint.h"
 #include "clang/Basic/LangOptions.h"
 #include "clang/StaticAnalyzer/Core/AnalyzerOptions.h"
+#include "clang/StaticAnalyzer/Core/CheckerProfiler.h"
 #include "clang/StaticAnalyzer/Core/PathSensitive/Store.h"
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/SmallVector.h"
+#include <algorithm>
+#include <memory>
 #include <vector>
 
 namespace clang {
@@ -156,7 +160,10 @@ public:
   CheckerManager(const LangOptions &langOpts,
                  AnalyzerOptionsRef AOptions)
     : LangOpts(langOpts),
-      AOptions(AOptions) {}
+      AOptions(AOptions) {
+    std::fill(&StmtCheckerOffsets[0][0],
+              &StmtCheckerOffsets[0][0] + 2 * (NumStmtClasses + 1), 0u);
+  }
 
   ~CheckerManager();
 
@@ -165,11 +172,23 @@ public:
 
   bool hasPathSensitiveCheckers() const;
 
+  /// \brief Called once all checkers are registered; builds the per-class
+  /// statement dispatch tables, so it must run before any analysis.
   void finishedCheckerRegistration();
 
   const LangOptions &getLangOpts() const { return LangOpts; }
   AnalyzerOptions &getAnalyzerOptions() { return *AOptions; }
 
+  /// \brief Start attributing callback time and generated nodes to each
+  /// checker. Enabled by the 'profile-checkers' config option.
+  void enableProfiling() {
+    if (!Profiler)
+      Profiler.reset(new CheckerProfiler());
+  }
+
+  /// \brief The profiler, or null if profiling is disabled.
+  CheckerProfiler *getProfiler() const { return Profiler.get(); }
+
   typedef CheckerBase *CheckerRef;
   typedef const void *CheckerTag;
   typedef CheckerFn<void ()> CheckerDtor;
@@ -254,6 +273,12 @@ public:
     runCheckersForStmt(/*isPreVisit=*/false, Dst, Src, S, Eng, wasInlined);
   }
 
+  /// \brief Whether any checker wants to visit \p S. When none does,
+  /// runCheckersForStmt simply copies its source set to its destination.
+  bool hasCheckersForStmt(const Stmt *S, bool isPreVisit) const {
+    return !getStmtCheckersFor(S, isPreVisit).empty();
+  }
+
   /// \brief Run checkers for visiting Stmts.
   void runCheckersForStmt(bool isPreVisit,
                           ExplodedNodeSet &Dst, const ExplodedNodeSet &Src,
@@ -604,12 +629,29 @@ private:
   };
   std::vector<StmtCheckerInfo> StmtCheckers;
 
-  typedef SmallVector<CheckStmtFunc, 4> CachedStmtCheckers;
-  typedef llvm::DenseMap<unsigned, CachedStmtCheckers> CachedStmtCheckersMapTy;
-  CachedStmtCheckersMapTy CachedStmtCheckersMap;
+  enum { NumStmtClasses = Stmt::lastStmtConstant + 1 };
 
-  const CachedStmtCheckers &getCachedStmtCheckersFor(const Stmt *S,
-                                                     bool isPreVisit);
+  /// \brief The statement checkers for every statement class, flattened
+  /// once by finishedCheckerRegistration().
+  ///
+  /// The checkers interested in pre-visits (index 1) or post-visits (index
+  /// 0) of class C are StmtCheckerTable[StmtCheckerOffsets[V][C]] up to
+  /// StmtCheckerTable[StmtCheckerOffsets[V][C+1]].
+  std::vector<CheckStmtFunc> StmtCheckerTable;
+  unsigned StmtCheckerOffsets[2][NumStmtClasses + 1];
+
+  ArrayRef<CheckStmtFunc> getStmtCheckersFor(const Stmt *S,
+                                             bool isPreVisit) const {
+    const unsigned *Offsets = StmtCheckerOffsets[isPreVisit];
+    unsigned C = S->getStmtClass();
+    if (Offsets[C] == Offsets[C + 1])
+      return None;
+    return ArrayRef<CheckStmtFunc>(&StmtCheckerTable[Offsets[C]],
+                                   Offsets[C + 1] - Offsets[C]);
+  }
+
+  /// \brief Fill StmtCheckerTable and StmtCheckerOffsets from StmtCheckers.
+  void buildStmtCheckerTable();
 
   std::vector<CheckObjCMessageFunc> PreObjCMessageCheckers;
   std::vector<CheckObjCMessageFunc> PostObjCMessageCheckers;
@@ -653,6 +695,8 @@ private:
   
   typedef llvm::DenseMap<EventTag, EventInfo> EventsTy;
   EventsTy Events;
+
+  std::unique_ptr<CheckerProfiler> Profiler;
 };
 
 } // end ento namespace
@@ -0,0 +1,125 @@
+//===--- CheckerProfiler.h - Per-checker cost attribution -------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+//  This file defines CheckerProfiler, which attributes the time spent in, and
+//  the exploded nodes generated by, each checker callback to the checker and
+//  callback kind responsible.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_SA_CORE_CHECKERPROFILER_H
+#define LLVM_CLANG_SA_CORE_CHECKERPROFILER_H
+
+#include "clang/Basic/LLVM.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/Support/Timer.h"
+
+namespace clang {
+namespace ento {
+
+class CheckerBase;
+
+/// \brief The checker callbacks that CheckerProfiler tells apart.
+enum CheckerCallbackKind {
+  CCK_ASTDecl,
+  CCK_ASTBody,
+  CCK_PreStmt,
+  CCK_PostStmt,
+  CCK_PreObjCMessage,
+  CCK_PostObjCMessage,
+  CCK_PreCall,
+  CCK_PostCall,
+  CCK_Location,
+  CCK_Bind,
+  CCK_EndAnalysis,
+  CCK_EndFunction,
+  CCK_BranchCondition,
+  CCK_LiveSymbols,
+  CCK_DeadSymbols,
+  CCK_RegionChanges,
+  CCK_PointerEscape,
+  CCK_EvalAssume,
+  CCK_EvalCall,
+  CCK_EndOfTranslationUnit,
+  NumCheckerCallbackKinds
+};
+
+/// \brief Returns the name of the checker callback \p K, e.g. "checkPreStmt".
+const char *getCheckerCallbackName(CheckerCallbackKind K);
+
+/// \brief Accumulates the cost of each (checker, callback kind) pair.
+///
+/// Each pair gets its own llvm::Timer in a "Checker callbacks" TimerGroup,
+/// named "<checker> <callback>", so the usual -ftime-report machinery sorts
+/// and prints them. Node counts are printed alongside by PrintStats.
+class CheckerProfiler {
+public:
+  struct Entry {
+    llvm::Timer Time;
+    unsigned NumCalls;
+    unsigned NumNodesGenerated;
+    Entry() : NumCalls(0), NumNodesGenerated(0) {}
+  };
+
+private:
+  llvm::TimerGroup Group;
+  typedef std::pair<const CheckerBase *, unsigned> KeyTy;
+  llvm::DenseMap<KeyTy, Entry *> Entries;
+
+  CheckerProfiler(const CheckerProfiler &) LLVM_DELETED_FUNCTION;
+  void operator=(const CheckerProfiler &) LLVM_DELETED_FUNCTION;
+
+public:
+  CheckerProfiler() : Group("Checker callbacks") {}
+  ~CheckerProfiler();
+
+  /// \brief Find or create the entry for \p Checker's \p Kind callback.
+  Entry &getEntry(const CheckerBase *Checker, CheckerCallbackKind Kind);
+
+  /// \brief Print call and node counts for every entry, most nodes first.
+  void PrintStats(raw_ostream &OS) const;
+};
+
+/// \brief Times one checker callback and charges the nodes it adds to a
+/// destination set.
+///
+/// \code
+///   CheckerCallbackTimer T(Profiler, checkFn.Checker, CCK_PreStmt, Dst);
+///   checkFn(S, C);
+/// \endcode
+template <typename NodeSetT>
+class CheckerCallbackTimer {
+  CheckerProfiler::Entry *E;
+  const NodeSetT &Dst;
+  unsigned SizeBefore;
+
+public:
+  CheckerCallbackTimer(CheckerProfiler *Profiler, const CheckerBase *Checker,
+                       CheckerCallbackKind Kind, const NodeSetT &Dst)
+    : E(Profiler ? &Profiler->getEntry(Checker, Kind) : 0), Dst(Dst),
+      SizeBefore(Dst.size()) {
+    if (E) {
+      ++E->NumCalls;
+      E->Time.startTimer();
+    }
+  }
+
+  ~CheckerCallbackTimer() {
+    if (!E)
+      return;
+    E->Time.stopTimer();
+    if (Dst.size() > SizeBefore)
+      E->NumNodesGenerated += Dst.size() - SizeBefore;
+  }
+};
+
+} // end ento namespace
+} // end clang namespace
+
+#endif
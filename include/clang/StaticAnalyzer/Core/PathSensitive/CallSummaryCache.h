@@ -0,0 +1,197 @@
+//== CallSummaryCache.h - Reusable effects of inlined calls -----*- C++ -*--==//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+//  This file defines CallSummaryCache, which remembers the outcome of
+//  inlining a callee that turned out to have no side effects and to depend
+//  only on its arguments, so that later calls with the same arguments can
+//  reuse it instead of inlining again.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_GR_CALLSUMMARYCACHE_H
+#define LLVM_CLANG_GR_CALLSUMMARYCACHE_H
+
+#include "clang/Analysis/AnalysisContext.h"
+#include "clang/StaticAnalyzer/Core/PathSensitive/MemRegion.h"
+#include "clang/StaticAnalyzer/Core/PathSensitive/SVals.h"
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseSet.h"
+#include "llvm/ADT/FoldingSet.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/Support/Allocator.h"
+#include <memory>
+
+namespace clang {
+
+class Decl;
+
+namespace ento {
+
+/// \brief The effect of one side-effect-free call, abstracted from the
+/// calling context.
+///
+/// A summary is keyed by the callee and by the values of its arguments, and
+/// records every value the call was seen to return along the feasible paths
+/// through the callee. Only calls whose inlined bodies did not read or write
+/// any region outside their own stack frame, did not add checker state to
+/// the GDM, and did not constrain any symbol visible to the caller are
+/// summarized. The state after the call then differs from the state before
+/// it only in the bound return value, and that value depends only on the
+/// arguments: a callee that reads a global or the heap may return something
+/// else once the caller has written to it, so it is never summarized.
+///
+/// A return value that mentions a symbol the callee created, such as the
+/// result of a call it evaluated conservatively, is marked fresh. Applying
+/// the summary conjures a new symbol for it at the call site, so that the
+/// results of two calls are not assumed to be equal.
+class CallSummary : public llvm::FoldingSetNode {
+  const Decl *Callee;
+  ArrayRef<SVal> Args;
+  ArrayRef<SVal> ReturnValues;
+  ArrayRef<bool> FreshReturnValues;
+
+public:
+  CallSummary(const Decl *Callee, ArrayRef<SVal> Args,
+              ArrayRef<SVal> ReturnValues, ArrayRef<bool> FreshReturnValues)
+    : Callee(Callee), Args(Args), ReturnValues(ReturnValues),
+      FreshReturnValues(FreshReturnValues) {}
+
+  const Decl *getCallee() const { return Callee; }
+  ArrayRef<SVal> getArgs() const { return Args; }
+
+  /// \brief The distinct values returned on the paths out of the callee.
+  /// Applying the summary forks one successor per value.
+  ArrayRef<SVal> getReturnValues() const { return ReturnValues; }
+
+  /// \brief Whether return value \p I must be replaced by a newly conjured
+  /// symbol of the call's type, rather than bound as recorded.
+  bool isFreshReturnValue(unsigned I) const { return FreshReturnValues[I]; }
+
+  /// \brief Whether \p V mentions a symbol that does not occur in \p Args,
+  /// i.e. one that was created while the callee ran.
+  static bool mentionsNewSymbols(SVal V, ArrayRef<SVal> Args) {
+    llvm::SmallPtrSet<SymbolRef, 8> ArgSymbols;
+    for (unsigned I = 0, E = Args.size(); I != E; ++I)
+      for (SymExpr::symbol_iterator SI = Args[I].symbol_begin(),
+                                    SE = Args[I].symbol_end();
+           SI != SE; ++SI)
+        ArgSymbols.insert(*SI);
+    for (SymExpr::symbol_iterator SI = V.symbol_begin(), SE = V.symbol_end();
+         SI != SE; ++SI)
+      if (!ArgSymbols.count(*SI))
+        return true;
+    return false;
+  }
+
+  void Profile(llvm::FoldingSetNodeID &ID) const {
+    Profile(ID, Callee, Args);
+  }
+
+  static void Profile(llvm::FoldingSetNodeID &ID, const Decl *Callee,
+                      ArrayRef<SVal> Args) {
+    ID.AddPointer(Callee);
+    ID.AddInteger(Args.size());
+    for (unsigned I = 0, E = Args.size(); I != E; ++I)
+      Args[I].Profile(ID);
+  }
+};
+
+/// \brief The call summaries computed by one ExprEngine.
+///
+/// SVals are only meaningful within the ProgramStateManager that created
+/// them, so the cache lives exactly as long as the engine that fills it.
+/// Summaries whose arguments mention symbols are still reusable within that
+/// analysis, since a symbol denotes the same unknown value on every path.
+class CallSummaryCache {
+  llvm::BumpPtrAllocator Alloc;
+  llvm::FoldingSet<CallSummary> Summaries;
+
+  /// Inlined frames that, themselves or through the calls they made, read
+  /// memory outside their own stack frame.
+  llvm::DenseSet<const StackFrameContext *> NonStackReaders;
+
+  unsigned NumApplied, NumRecorded;
+
+  CallSummaryCache(const CallSummaryCache &) LLVM_DELETED_FUNCTION;
+  void operator=(const CallSummaryCache &) LLVM_DELETED_FUNCTION;
+
+public:
+  CallSummaryCache() : NumApplied(0), NumRecorded(0) {}
+
+  /// \brief Find the summary for calling \p Callee with \p Args.
+  const CallSummary *lookup(const Decl *Callee, ArrayRef<SVal> Args) {
+    llvm::FoldingSetNodeID ID;
+    CallSummary::Profile(ID, Callee, Args);
+    void *InsertPos;
+    const CallSummary *S = Summaries.FindNodeOrInsertPos(ID, InsertPos);
+    if (S)
+      ++NumApplied;
+    return S;
+  }
+
+  /// \brief Note that the code running in \p LC loaded from \p R. Every
+  /// frame on the way from \p LC out to the frame owning \p R, or all of
+  /// them if \p R is not a stack region of one of them, can no longer be
+  /// summarized. ExprEngine calls this for every load.
+  void noteLoad(const MemRegion *R, const LocationContext *LC) {
+    const StackFrameContext *Owner = 0;
+    if (const StackSpaceRegion *SR =
+            dyn_cast<StackSpaceRegion>(R->getMemorySpace()))
+      Owner = SR->getStackFrame();
+    for (const StackFrameContext *SFC = LC->getCurrentStackFrame();
+         SFC && SFC != Owner;
+         SFC = SFC->getParent() ? SFC->getParent()->getCurrentStackFrame() : 0)
+      NonStackReaders.insert(SFC);
+  }
+
+  /// \brief Whether the inlined call running in \p CalleeCtx loaded from
+  /// memory outside its own stack frame on any path, in which case it must
+  /// not be summarized.
+  bool readsNonStackMemory(const StackFrameContext *CalleeCtx) const {
+    return NonStackReaders.count(CalleeCtx);
+  }
+
+  /// \brief Record that calling \p Callee with \p Args had no side effects,
+  /// read no memory outside its stack frame, and returned one of
+  /// \p ReturnValues.
+  const CallSummary *record(const Decl *Callee, ArrayRef<SVal> Args,
+                            ArrayRef<SVal> ReturnValues) {
+    llvm::FoldingSetNodeID ID;
+    CallSummary::Profile(ID, Callee, Args);
+    void *InsertPos;
+    if (CallSummary *S = Summaries.FindNodeOrInsertPos(ID, InsertPos))
+      return S;
+
+    SVal *ArgsCopy = Alloc.Allocate<SVal>(Args.size());
+    std::uninitialized_copy(Args.begin(), Args.end(), ArgsCopy);
+    SVal *RetsCopy = Alloc.Allocate<SVal>(ReturnValues.size());
+    std::uninitialized_copy(ReturnValues.begin(), ReturnValues.end(),
+                            RetsCopy);
+    bool *Fresh = Alloc.Allocate<bool>(ReturnValues.size());
+    for (unsigned I = 0, E = ReturnValues.size(); I != E; ++I)
+      Fresh[I] = CallSummary::mentionsNewSymbols(ReturnValues[I], Args);
+
+    CallSummary *S = new (Alloc.Allocate<CallSummary>()) CallSummary(
+        Callee, ArrayRef<SVal>(ArgsCopy, Args.size()),
+        ArrayRef<SVal>(RetsCopy, ReturnValues.size()),
+        ArrayRef<bool>(Fresh, ReturnValues.size()));
+    Summaries.InsertNode(S, InsertPos);
+    ++NumRecorded;
+    return S;
+  }
+
+  unsigned getNumApplied() const { return NumApplied; }
+  unsigned getNumRecorded() const { return NumRecorded; }
+};
+
+} // end GR namespace
+
+} // end clang namespace
+
+#endif
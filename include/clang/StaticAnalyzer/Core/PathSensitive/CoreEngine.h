@@ -17,6 +17,7 @@
 
 #include "clang/AST/Expr.h"
 #include "clang/Analysis/AnalysisContext.h"
+#include "clang/StaticAnalyzer/Core/AnalyzerOptions.h"
 #include "clang/StaticAnalyzer/Core/PathSensitive/BlockCounter.h"
 #include "clang/StaticAnalyzer/Core/PathSensitive/ExplodedGraph.h"
 #include "clang/StaticAnalyzer/Core/PathSensitive/FunctionSummary.h"
@@ -106,12 +107,16 @@ private:
 
   ExplodedNode *generateCallExitBeginNode(ExplodedNode *N);
 
+  /// Create the work list selected by the 'exploration-strategy' option.
+  static WorkList *generateWorkList(AnalyzerOptions &Opts);
+
 public:
   /// Construct a CoreEngine object to analyze the provided CFG.
   CoreEngine(SubEngine& subengine,
-             FunctionSummariesTy *FS)
+             FunctionSummariesTy *FS,
+             AnalyzerOptions &Opts)
     : SubEng(subengine), G(new ExplodedGraph()),
-      WList(WorkList::makeDFS()),
+      WList(generateWorkList(Opts)),
       BCounterFactory(G->getAllocator()),
       FunctionSummaries(FS){}
 
@@ -21,6 +21,7 @@
 #include "clang/Analysis/DomainSpecific/ObjCNoReturn.h"
 #include "clang/StaticAnalyzer/Core/BugReporter/BugReporter.h"
 #include "clang/StaticAnalyzer/Core/PathSensitive/AnalysisManager.h"
+#include "clang/StaticAnalyzer/Core/PathSensitive/CallSummaryCache.h"
 #include "clang/StaticAnalyzer/Core/PathSensitive/CoreEngine.h"
 #include "clang/StaticAnalyzer/Core/PathSensitive/ProgramState.h"
 #include "clang/StaticAnalyzer/Core/PathSensitive/ProgramStateTrait.h"
@@ -96,6 +97,10 @@ private:
   /// The flag, which specifies the mode of inlining for the engine.
   InliningModes HowToInline;
 
+  /// Summaries of side-effect-free callees, used instead of inlining them
+  /// again when the 'ipa-call-summaries' option is enabled.
+  CallSummaryCache CallSummaries;
+
 public:
   ExprEngine(AnalysisManager &mgr, bool gcEnabled,
              SetOfConstDecls *VisitedCalleesIn,
@@ -499,7 +504,8 @@ public:
   // FIXME: Comment on the meaning of the arguments, when 'St' may not
   // be the same as Pred->state, and when 'location' may not be the
   // same as state->getLValue(Ex).
-  /// Simulate a read of the result of Ex.
+  /// Simulate a read of the result of Ex. When call summaries are enabled,
+  /// the loaded region is also passed to CallSummaryCache::noteLoad.
   void evalLoad(ExplodedNodeSet &Dst,
                 const Expr *NodeEx,  /* Eventually will be a CFGStmt */
                 const Expr *BoundExpr,
@@ -559,6 +565,22 @@ private:
   bool inlineCall(const CallEvent &Call, const Decl *D, NodeBuilder &Bldr,
                   ExplodedNode *Pred, ProgramStateRef State);
 
+  /// \brief Evaluate \p Call from a recorded summary of \p D, if there is
+  /// one for its argument values, binding each summarized return value on
+  /// its own path. Return values the summary marks fresh are replaced by a
+  /// symbol conjured for this call.
+  ///
+  /// \returns true if a summary was applied.
+  bool applyCallSummary(const CallEvent &Call, const Decl *D,
+                        NodeBuilder &Bldr, ExplodedNode *Pred,
+                        ProgramStateRef State);
+
+  /// \brief Once every path through an inlined call of \p CalleeCtx has
+  /// reached its exit, record a summary if none of them had side effects
+  /// visible to the caller or read memory outside the callee's stack frame.
+  void recordCallSummary(const StackFrameContext *CalleeCtx,
+                         ExplodedNode *CallExitEnd);
+
   /// \brief Conservatively evaluate call by invalidating regions and binding
   /// a conjured return value.
   void conservativeEvalCall(const CallEvent &Call, NodeBuilder &Bldr,
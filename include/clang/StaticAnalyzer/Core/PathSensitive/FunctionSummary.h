@@ -133,6 +133,11 @@ public:
   unsigned getTotalNumBasicBlocks();
   unsigned getTotalNumVisitedBasicBlocks();
 
+  /// Print, for every analyzed function, how many of its CFG blocks were
+  /// reached. Emitted under -analyzer-stats to compare exploration
+  /// strategies for a given node budget.
+  void printBlockCoverage(raw_ostream &OS) const;
+
 };
 
 }} // end clang ento namespaces
@@ -91,6 +91,14 @@ public:
   static WorkList *makeDFS();
   static WorkList *makeBFS();
   static WorkList *makeBFSBlockDFSContents();
+
+  /// \brief Create a priority work list that dequeues first the nodes in CFG
+  /// blocks, and the calls into functions, it has seen least often.
+  ///
+  /// Under a fixed node budget this spreads exploration over the whole
+  /// function instead of spending it on repeated trips through a few loops.
+  /// Ties are broken in depth-first order.
+  static WorkList *makeUnexploredFirst();
 };
 
 } // end GR namespace
@@ -37,6 +37,12 @@ public:
 /// CreateAnalysisConsumer - Creates an ASTConsumer to run various code
 /// analysis passes.  (The set of analyses run is controlled by command-line
 /// options.)
+///
+/// When the 'analysis-threads' config option is greater than one, the
+/// path-sensitive analyses of independent call graph roots run concurrently.
+/// Each worker owns its AnalysisManager, ExprEngine, ProgramStateManager and
+/// BugReporter; only the PathDiagnosticConsumers are shared, and they
+/// deduplicate and sort the reports when flushed.
 AnalysisASTConsumer *CreateAnalysisConsumer(const Preprocessor &pp,
                                             const std::string &output,
                                             AnalyzerOptionsRef opts,
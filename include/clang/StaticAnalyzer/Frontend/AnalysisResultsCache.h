@@ -0,0 +1,82 @@
+//===--- AnalysisResultsCache.h - Reuse results across runs -----*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file defines AnalysisResultsCache, which stores the path diagnostics
+// produced for a translation unit so that an unchanged translation unit does
+// not have to be analyzed again.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_GR_ANALYSISRESULTSCACHE_H
+#define LLVM_CLANG_GR_ANALYSISRESULTSCACHE_H
+
+#include "clang/Basic/LLVM.h"
+#include "clang/StaticAnalyzer/Core/AnalyzerOptions.h"
+#include "clang/StaticAnalyzer/Core/BugReporter/PathDiagnostic.h"
+#include "llvm/ADT/SmallString.h"
+#include <string>
+#include <vector>
+
+namespace clang {
+
+class Preprocessor;
+
+namespace ento {
+
+/// \brief A directory of analysis results keyed by everything that can
+/// change them.
+///
+/// The key of a translation unit is a hash of its preprocessed token stream
+/// (every token spelling and the file it came from, so edits to any included
+/// header change it), the compiler version, the analyzer options that affect
+/// analysis, including the -analyzer-config table, and the ordered list of
+/// enabled and disabled checkers.
+///
+/// An entry holds the diagnostics that were handed to the
+/// PathDiagnosticConsumers for that key, in the consumers' plist form. On a
+/// hit, AnalysisConsumer skips analysis and feeds the stored diagnostics to
+/// its consumers instead, so every output format is reproduced. Entries are
+/// written to a unique temporary file and renamed into place, so concurrent
+/// scan-build jobs may share a cache directory.
+class AnalysisResultsCache {
+  std::string CacheDir;
+  llvm::SmallString<40> Key;
+
+public:
+  explicit AnalysisResultsCache(StringRef CacheDir) : CacheDir(CacheDir) {}
+
+  /// \brief Compute the key for the main file of \p PP, analyzed with
+  /// \p Opts. Must be called after the translation unit has been parsed.
+  void computeKey(Preprocessor &PP, AnalyzerOptions &Opts);
+
+  /// \brief The key computed by computeKey, as a hex string.
+  StringRef getKey() const { return Key; }
+
+  /// \brief Load the diagnostics stored for the current key.
+  ///
+  /// \returns false if there is no valid entry. On success the caller owns
+  /// the diagnostics in \p Diags.
+  bool lookup(std::vector<PathDiagnostic *> &Diags);
+
+  /// \brief Store \p Diags as the results for the current key.
+  ///
+  /// \returns true if the entry could not be written; the analysis result
+  /// itself is unaffected.
+  bool store(ArrayRef<const PathDiagnostic *> Diags);
+
+  /// \brief A PathDiagnosticConsumer that records every diagnostic it is
+  /// given and writes them to the cache when flushed.
+  PathDiagnosticConsumer *createRecordingConsumer();
+};
+
+} // end GR namespace
+
+} // end clang namespace
+
+#endif
@@ -20,6 +20,9 @@ namespace ento {
 // AST Consumer Actions
 //===----------------------------------------------------------------------===//
 
+/// AnalysisAction - Run the static analyzer (--analyze). Creating its
+/// consumer also creates the CompilerInstance's shared CFG cache, so that
+/// the CFGs built for analysis-based warnings are reused by the analyzer.
 class AnalysisAction : public ASTFrontendAction {
 protected:
   ASTConsumer *CreateASTConsumer(CompilerInstance &CI,
@@ -23,6 +23,7 @@
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/SourceMgr.h"
 #include "llvm/Support/YAMLParser.h"
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -62,6 +63,20 @@ public:
   static JSONCompilationDatabase *loadFromBuffer(StringRef DatabaseString,
                                                  std::string &ErrorMessage);
 
+  /// \brief Loads a JSON compilation database without parsing its entries.
+  ///
+  /// The file is memory mapped and only scanned for the byte range and 'file'
+  /// attribute of each entry; the remaining attributes of an entry are parsed
+  /// when it is first queried. If \p IndexPath is non-empty, the scan result
+  /// is read from that sidecar file when it is newer than the database, and
+  /// written to it otherwise.
+  ///
+  /// Returns NULL and sets ErrorMessage if the database could not be
+  /// loaded from the given file.
+  static JSONCompilationDatabase *loadFromFileLazily(StringRef FilePath,
+                                                     StringRef IndexPath,
+                                                     std::string &ErrorMessage);
+
   /// \brief Returns all compile comamnds in which the specified file was
   /// compiled.
   ///
@@ -82,7 +97,8 @@ public:
 private:
   /// \brief Constructs a JSON compilation database on a memory buffer.
   JSONCompilationDatabase(llvm::MemoryBuffer *Database)
-    : Database(Database), YAMLStream(Database->getBuffer(), SM) {}
+    : Database(Database), YAMLStream(Database->getBuffer(), SM),
+      IsLazy(false) {}
 
   /// \brief Parses the database file and creates the index.
   ///
@@ -99,6 +115,22 @@ private:
   void getCommands(ArrayRef<CompileCommandRef> CommandsRef,
                    std::vector<CompileCommand> &Commands) const;
 
+  // Offset and length of one entry object within the database buffer.
+  typedef std::pair<unsigned, unsigned> EntryRange;
+
+  /// \brief Scans the database for entry boundaries and 'file' attributes
+  /// without building a YAML node tree, filling LazyIndexByFile.
+  bool scanEntries(std::string &ErrorMessage);
+
+  /// \brief Reads LazyIndexByFile from a sidecar index file.
+  bool readIndex(StringRef IndexPath);
+
+  /// \brief Writes LazyIndexByFile to a sidecar index file.
+  bool writeIndex(StringRef IndexPath) const;
+
+  /// \brief Parses the entry at \p Range, caching the result.
+  const CompileCommand *parseEntry(EntryRange Range) const;
+
   // Maps file paths to the compile command lines for that file.
   llvm::StringMap< std::vector<CompileCommandRef> > IndexByFile;
 
@@ -107,6 +139,15 @@ private:
   std::unique_ptr<llvm::MemoryBuffer> Database;
   llvm::SourceMgr SM;
   llvm::yaml::Stream YAMLStream;
+
+  // Whether entries are parsed on demand from LazyIndexByFile.
+  bool IsLazy;
+
+  // Maps file paths to the byte ranges of their entries, in lazy mode.
+  llvm::StringMap< std::vector<EntryRange> > LazyIndexByFile;
+
+  // Entries parsed so far in lazy mode, keyed by offset.
+  mutable std::map<unsigned, CompileCommand> ParsedEntries;
 };
 
 } // end namespace tooling
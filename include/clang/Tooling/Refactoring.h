@@ -22,6 +22,7 @@
 #include "clang/Basic/SourceLocation.h"
 #include "clang/Tooling/Tooling.h"
 #include "llvm/ADT/StringRef.h"
+#include "llvm/Support/Mutex.h"
 #include <set>
 #include <string>
 
@@ -208,6 +209,13 @@ public:
   /// be added during the run of the tool.
   Replacements &getReplacements();
 
+  /// \brief Merge \p Other into the set of replacements of this tool.
+  ///
+  /// This may be called concurrently from the worker threads of a
+  /// multithreaded run; since \c Replacements is ordered, the merged set does
+  /// not depend on the order in which files were processed.
+  void addReplacements(const Replacements &Other);
+
   /// \brief Call run(), apply all generated replacements, and immediately save
   /// the results to disk.
   ///
@@ -228,6 +236,7 @@ private:
 
 private:
   Replacements Replace;
+  llvm::sys::Mutex ReplaceLock;
 };
 
 template <typename Node>
@@ -275,18 +275,44 @@ class ClangTool {
   /// \brief Clear the command line arguments adjuster chain.
   void clearArgumentsAdjusters();
 
+  /// \brief Set the number of worker threads used by run() and buildASTs().
+  ///
+  /// With more than one thread, compile commands are dispatched to workers
+  /// which each own a FileManager and DiagnosticsEngine. Calls into the
+  /// DiagnosticConsumer are serialized.
+  void setNumThreads(unsigned N) { NumThreads = N ? N : 1; }
+  unsigned getNumThreads() const { return NumThreads; }
+
   /// Runs an action over all files specified in the command line.
   ///
+  /// If more than one thread is used, \p Action is invoked concurrently and
+  /// must be thread-safe.
+  ///
   /// \param Action Tool action.
   int run(ToolAction *Action);
 
   /// \brief Create an AST for each file specified in the command line and
   /// append them to ASTs.
+  ///
+  /// The ASTs are appended in compile command order, regardless of the
+  /// number of threads used to build them.
   int buildASTs(std::vector<ASTUnit *> &ASTs);
 
+  /// \brief Cache the AST of each translation unit built by buildASTs() in
+  /// \p Dir, and load it from there on later runs.
+  ///
+  /// An entry is named by a hash of the adjusted compile command and the
+  /// contents of the main file. It is used only when every input file it
+  /// records is unchanged, which the ASTReader checks when loading it lazily.
+  /// Otherwise the file is parsed again and the entry replaced. An empty
+  /// \p Dir, the default, disables the cache.
+  void setASTCacheDir(StringRef Dir) { ASTCacheDir = Dir; }
+  StringRef getASTCacheDir() const { return ASTCacheDir; }
+
   /// \brief Returns the file manager used in the tool.
   ///
-  /// The file manager is shared between all translation units.
+  /// The file manager is shared between all translation units when running
+  /// with a single thread; worker threads use their own.
   FileManager &getFiles() { return *Files; }
 
  private:
@@ -300,6 +326,10 @@ class ClangTool {
   SmallVector<ArgumentsAdjuster *, 2> ArgsAdjusters;
 
   DiagnosticConsumer *DiagConsumer;
+
+  unsigned NumThreads;
+
+  std::string ASTCacheDir;
 };
 
 template <typename T>
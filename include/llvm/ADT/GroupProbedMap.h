@@ -0,0 +1,448 @@
+//===- llvm/ADT/GroupProbedMap.h - Group probed hash table ------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file defines the GroupProbedMap class, an open addressed hash map with
+// the interface of DenseMap that probes sixteen buckets at a time.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_ADT_GROUPPROBEDMAP_H
+#define LLVM_ADT_GROUPPROBEDMAP_H
+
+#include "llvm/ADT/DenseMapInfo.h"
+#include "llvm/Support/Compiler.h"
+#include "llvm/Support/DataTypes.h"
+#include "llvm/Support/MathExtras.h"
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LLVM_GROUPPROBEDMAP_SSE2 1
+#endif
+
+namespace llvm {
+
+namespace detail {
+/// GroupProbeCtrl - The control bytes of a GroupProbedMap: one per bucket,
+/// holding either one of the states below or 7 bits of the key's hash.
+struct GroupProbeCtrl {
+  static const int8_t Empty = -128;
+  static const int8_t Deleted = -2;
+  static const unsigned GroupWidth = 16;
+
+  /// matchByte - Bit I of the result is set if byte I of the group starting
+  /// at \p Ctrl is \p B.
+  static unsigned matchByte(const int8_t *Ctrl, int8_t B) {
+#ifdef LLVM_GROUPPROBEDMAP_SSE2
+    __m128i G = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Ctrl));
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(B), G));
+#else
+    unsigned Mask = 0;
+    for (unsigned I = 0; I != GroupWidth; ++I)
+      if (Ctrl[I] == B)
+        Mask |= 1U << I;
+    return Mask;
+#endif
+  }
+
+  /// matchFree - Bit I of the result is set if bucket I of the group is
+  /// empty or deleted, which are the only states with the sign bit set.
+  static unsigned matchFree(const int8_t *Ctrl) {
+#ifdef LLVM_GROUPPROBEDMAP_SSE2
+    __m128i G = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Ctrl));
+    return _mm_movemask_epi8(G);
+#else
+    unsigned Mask = 0;
+    for (unsigned I = 0; I != GroupWidth; ++I)
+      if (Ctrl[I] < 0)
+        Mask |= 1U << I;
+    return Mask;
+#endif
+  }
+};
+} // end namespace detail
+
+template <typename KeyT, typename ValueT, typename KeyInfoT, bool IsConst>
+class GroupProbedMapIterator;
+
+/// GroupProbedMap - A hash map from KeyT to ValueT with the interface of
+/// DenseMap, for large, hot maps such as the Value and SDNode maps of GVN
+/// and SelectionDAG.
+///
+/// DenseMap probes one bucket at a time, and each probe loads a bucket of
+/// key and value. GroupProbedMap keeps a separate array of one control byte
+/// per bucket, holding 7 bits of the key's hash. A lookup compares a group
+/// of 16 control bytes with one SSE2 instruction (a portable loop on other
+/// hosts) and only loads the buckets whose byte matches, which is almost
+/// always the one it looks for. The table is kept at most 7/8 full.
+///
+/// KeyInfoT needs getHashValue and isEqual only. The empty and tombstone
+/// keys are not used, so every key value can be stored. The weak pointer
+/// hash of DenseMapInfo is mixed before use.
+///
+/// As with DenseMap, inserting may invalidate iterators and references to
+/// the elements; erasing does not.
+template <typename KeyT, typename ValueT,
+          typename KeyInfoT = DenseMapInfo<KeyT> >
+class GroupProbedMap {
+  typedef detail::GroupProbeCtrl Ctrl;
+
+public:
+  typedef KeyT key_type;
+  typedef ValueT mapped_type;
+  typedef std::pair<KeyT, ValueT> value_type;
+  typedef unsigned size_type;
+  typedef GroupProbedMapIterator<KeyT, ValueT, KeyInfoT, false> iterator;
+  typedef GroupProbedMapIterator<KeyT, ValueT, KeyInfoT, true> const_iterator;
+  friend class GroupProbedMapIterator<KeyT, ValueT, KeyInfoT, false>;
+  friend class GroupProbedMapIterator<KeyT, ValueT, KeyInfoT, true>;
+
+private:
+  /// Capacity + GroupWidth control bytes. The last GroupWidth mirror the
+  /// first ones, so a group can be loaded at any bucket without wrapping.
+  int8_t *CtrlBytes;
+  value_type *Buckets;
+  unsigned Capacity;
+  unsigned NumEntries;
+  unsigned NumDeleted;
+
+  /// The high bits of the product depend on every bit of the hash, so both
+  /// the control byte and the probe start are taken from them.
+  static uint64_t mixHash(const KeyT &Key) {
+    return uint64_t(KeyInfoT::getHashValue(Key)) * 0x9E3779B97F4A7C15ULL;
+  }
+  static int8_t getH2(uint64_t Hash) { return int8_t(Hash >> 57); }
+  static unsigned getH1(uint64_t Hash) { return unsigned(Hash >> 25); }
+
+  bool isFull(unsigned I) const { return CtrlBytes[I] >= 0; }
+
+  void setCtrl(unsigned I, int8_t C) {
+    CtrlBytes[I] = C;
+    if (I < Ctrl::GroupWidth)
+      CtrlBytes[Capacity + I] = C;
+  }
+
+  void allocate(unsigned NewCapacity) {
+    Capacity = NewCapacity;
+    NumEntries = NumDeleted = 0;
+    if (!Capacity) {
+      CtrlBytes = nullptr;
+      Buckets = nullptr;
+      return;
+    }
+    CtrlBytes = static_cast<int8_t *>(malloc(Capacity + Ctrl::GroupWidth));
+    memset(CtrlBytes, Ctrl::Empty, Capacity + Ctrl::GroupWidth);
+    Buckets = static_cast<value_type *>(
+        malloc(sizeof(value_type) * size_t(Capacity)));
+  }
+
+  void destroyAll() {
+    for (unsigned I = 0; I != Capacity; ++I)
+      if (isFull(I))
+        Buckets[I].~value_type();
+  }
+
+  /// findIndex - The bucket holding \p Key, or -1.
+  int findIndex(const KeyT &Key) const {
+    if (!Capacity)
+      return -1;
+    uint64_t Hash = mixHash(Key);
+    int8_t H2 = getH2(Hash);
+    unsigned Mask = Capacity - 1;
+    unsigned Pos = getH1(Hash) & Mask;
+    for (unsigned Step = Ctrl::GroupWidth;; Step += Ctrl::GroupWidth) {
+      const int8_t *Group = CtrlBytes + Pos;
+      for (unsigned M = Ctrl::matchByte(Group, H2); M; M &= M - 1) {
+        unsigned I = (Pos + countTrailingZeros(M)) & Mask;
+        if (KeyInfoT::isEqual(Buckets[I].first, Key))
+          return I;
+      }
+      // An empty bucket ends every probe sequence that could hold Key.
+      if (Ctrl::matchByte(Group, Ctrl::Empty))
+        return -1;
+      Pos = (Pos + Step) & Mask;
+    }
+  }
+
+  /// findFreeIndex - The first empty or deleted bucket of the probe
+  /// sequence of \p Hash. The table must have one.
+  unsigned findFreeIndex(uint64_t Hash) const {
+    unsigned Mask = Capacity - 1;
+    unsigned Pos = getH1(Hash) & Mask;
+    for (unsigned Step = Ctrl::GroupWidth;; Step += Ctrl::GroupWidth) {
+      if (unsigned M = Ctrl::matchFree(CtrlBytes + Pos))
+        return (Pos + countTrailingZeros(M)) & Mask;
+      Pos = (Pos + Step) & Mask;
+    }
+  }
+
+  /// rehash - Move the entries into a table of \p NewCapacity buckets,
+  /// which drops the deleted markers as well.
+  void rehash(unsigned NewCapacity) {
+    int8_t *OldCtrl = CtrlBytes;
+    value_type *OldBuckets = Buckets;
+    unsigned OldCapacity = Capacity;
+    unsigned OldEntries = NumEntries;
+    allocate(NewCapacity);
+    for (unsigned I = 0; I != OldCapacity; ++I) {
+      if (OldCtrl[I] < 0)
+        continue;
+      uint64_t Hash = mixHash(OldBuckets[I].first);
+      unsigned J = findFreeIndex(Hash);
+      setCtrl(J, getH2(Hash));
+      ::new (&Buckets[J]) value_type(std::move(OldBuckets[I]));
+      OldBuckets[I].~value_type();
+    }
+    NumEntries = OldEntries;
+    free(OldCtrl);
+    free(OldBuckets);
+  }
+
+  /// Capacity for \p N entries at the maximum load factor of 7/8.
+  static unsigned getMinCapacity(unsigned N) {
+    if (N == 0)
+      return 0;
+    uint64_t Min = uint64_t(N) * 8 / 7 + 1;
+    return std::max<uint64_t>(Ctrl::GroupWidth, NextPowerOf2(Min - 1));
+  }
+
+  /// prepareInsert - Make room for one more entry with \p Hash and return
+  /// the bucket it goes into.
+  unsigned prepareInsert(uint64_t Hash) {
+    if ((NumEntries + NumDeleted + 1) * uint64_t(8) > uint64_t(Capacity) * 7) {
+      // Mostly deleted markers: clean them up in place instead of growing.
+      if (!Capacity)
+        rehash(Ctrl::GroupWidth);
+      else if (NumEntries * uint64_t(16) < uint64_t(Capacity) * 7)
+        rehash(Capacity);
+      else
+        rehash(Capacity * 2);
+    }
+    unsigned I = findFreeIndex(Hash);
+    if (CtrlBytes[I] == Ctrl::Deleted)
+      --NumDeleted;
+    ++NumEntries;
+    setCtrl(I, getH2(Hash));
+    return I;
+  }
+
+public:
+  explicit GroupProbedMap(unsigned InitialReserve = 0) {
+    allocate(getMinCapacity(InitialReserve));
+  }
+
+  GroupProbedMap(const GroupProbedMap &Other) {
+    allocate(Other.Capacity);
+    memcpy(CtrlBytes, Other.CtrlBytes, Capacity ? Capacity + Ctrl::GroupWidth
+                                                : 0);
+    for (unsigned I = 0; I != Capacity; ++I)
+      if (isFull(I))
+        ::new (&Buckets[I]) value_type(Other.Buckets[I]);
+    NumEntries = Other.NumEntries;
+    NumDeleted = Other.NumDeleted;
+  }
+
+  GroupProbedMap(GroupProbedMap &&Other) {
+    allocate(0);
+    swap(Other);
+  }
+
+  GroupProbedMap &operator=(GroupProbedMap Other) {
+    swap(Other);
+    return *this;
+  }
+
+  ~GroupProbedMap() {
+    destroyAll();
+    free(CtrlBytes);
+    free(Buckets);
+  }
+
+  void swap(GroupProbedMap &RHS) {
+    std::swap(CtrlBytes, RHS.CtrlBytes);
+    std::swap(Buckets, RHS.Buckets);
+    std::swap(Capacity, RHS.Capacity);
+    std::swap(NumEntries, RHS.NumEntries);
+    std::swap(NumDeleted, RHS.NumDeleted);
+  }
+
+  iterator begin() { return iterator(this, 0); }
+  iterator end() { return iterator(this, Capacity); }
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, Capacity); }
+
+  bool empty() const { return NumEntries == 0; }
+  unsigned size() const { return NumEntries; }
+
+  /// reserve - Grow the table so \p NumEntries entries fit without another
+  /// rehash.
+  void reserve(size_type NumEntries) {
+    unsigned NewCapacity = getMinCapacity(NumEntries);
+    if (NewCapacity > Capacity)
+      rehash(NewCapacity);
+  }
+
+  void clear() {
+    if (NumEntries == 0 && NumDeleted == 0)
+      return;
+    destroyAll();
+    memset(CtrlBytes, Ctrl::Empty, Capacity + Ctrl::GroupWidth);
+    NumEntries = NumDeleted = 0;
+  }
+
+  size_type count(const KeyT &Key) const { return findIndex(Key) >= 0; }
+
+  iterator find(const KeyT &Key) {
+    int I = findIndex(Key);
+    return I < 0 ? end() : iterator(this, I, true);
+  }
+  const_iterator find(const KeyT &Key) const {
+    int I = findIndex(Key);
+    return I < 0 ? end() : const_iterator(this, I, true);
+  }
+
+  /// lookup - Return the value for \p Key, or a default constructed value if
+  /// there is none.
+  ValueT lookup(const KeyT &Key) const {
+    int I = findIndex(Key);
+    return I < 0 ? ValueT() : Buckets[I].second;
+  }
+
+  std::pair<iterator, bool> insert(const value_type &KV) {
+    int I = findIndex(KV.first);
+    if (I >= 0)
+      return std::make_pair(iterator(this, I, true), false);
+    unsigned J = prepareInsert(mixHash(KV.first));
+    ::new (&Buckets[J]) value_type(KV);
+    return std::make_pair(iterator(this, J, true), true);
+  }
+
+  std::pair<iterator, bool> insert(value_type &&KV) {
+    int I = findIndex(KV.first);
+    if (I >= 0)
+      return std::make_pair(iterator(this, I, true), false);
+    unsigned J = prepareInsert(mixHash(KV.first));
+    ::new (&Buckets[J]) value_type(std::move(KV));
+    return std::make_pair(iterator(this, J, true), true);
+  }
+
+  template <typename InputIt> void insert(InputIt I, InputIt E) {
+    for (; I != E; ++I)
+      insert(*I);
+  }
+
+  value_type &FindAndConstruct(const KeyT &Key) {
+    int I = findIndex(Key);
+    if (I >= 0)
+      return Buckets[I];
+    unsigned J = prepareInsert(mixHash(Key));
+    ::new (&Buckets[J]) value_type(Key, ValueT());
+    return Buckets[J];
+  }
+
+  ValueT &operator[](const KeyT &Key) { return FindAndConstruct(Key).second; }
+
+  bool erase(const KeyT &Key) {
+    int I = findIndex(Key);
+    if (I < 0)
+      return false;
+    erase(iterator(this, I, true));
+    return true;
+  }
+
+  void erase(iterator I) {
+    unsigned Idx = I.Idx;
+    assert(isFull(Idx) && "Erasing an empty bucket!");
+    Buckets[Idx].~value_type();
+    // A deleted marker keeps the probe sequences running through this bucket
+    // intact.
+    setCtrl(Idx, Ctrl::Deleted);
+    --NumEntries;
+    ++NumDeleted;
+  }
+
+  /// getMemorySize - The heap memory used by the table.
+  size_t getMemorySize() const {
+    return Capacity ? size_t(Capacity) * (sizeof(value_type) + 1) +
+                          Ctrl::GroupWidth
+                    : 0;
+  }
+};
+
+template <typename KeyT, typename ValueT, typename KeyInfoT, bool IsConst>
+class GroupProbedMapIterator {
+  typedef GroupProbedMap<KeyT, ValueT, KeyInfoT> MapT;
+  typedef typename std::conditional<IsConst, const MapT, MapT>::type
+      MapRefT;
+  friend class GroupProbedMap<KeyT, ValueT, KeyInfoT>;
+  friend class GroupProbedMapIterator<KeyT, ValueT, KeyInfoT, true>;
+
+public:
+  typedef ptrdiff_t difference_type;
+  typedef typename std::conditional<IsConst, const std::pair<KeyT, ValueT>,
+                                    std::pair<KeyT, ValueT> >::type value_type;
+  typedef value_type *pointer;
+  typedef value_type &reference;
+  typedef std::forward_iterator_tag iterator_category;
+
+private:
+  MapRefT *Map;
+  unsigned Idx;
+
+  void advancePastFree() {
+    while (Idx != Map->Capacity && !Map->isFull(Idx))
+      ++Idx;
+  }
+
+public:
+  GroupProbedMapIterator() : Map(nullptr), Idx(0) {}
+  GroupProbedMapIterator(MapRefT *Map, unsigned Idx, bool NoAdvance = false)
+    : Map(Map), Idx(Idx) {
+    if (!NoAdvance)
+      advancePastFree();
+  }
+
+  // Converting ctor from non-const iterators to const iterators.
+  GroupProbedMapIterator(
+      const GroupProbedMapIterator<KeyT, ValueT, KeyInfoT, false> &I)
+    : Map(I.Map), Idx(I.Idx) {}
+
+  reference operator*() const { return Map->Buckets[Idx]; }
+  pointer operator->() const { return &Map->Buckets[Idx]; }
+
+  bool operator==(const GroupProbedMapIterator &RHS) const {
+    return Idx == RHS.Idx && Map == RHS.Map;
+  }
+  bool operator!=(const GroupProbedMapIterator &RHS) const {
+    return !(*this == RHS);
+  }
+
+  GroupProbedMapIterator &operator++() {
+    ++Idx;
+    advancePastFree();
+    return *this;
+  }
+  GroupProbedMapIterator operator++(int) {
+    GroupProbedMapIterator Tmp = *this;
+    ++*this;
+    return Tmp;
+  }
+};
+
+} // end namespace llvm
+
+#endif
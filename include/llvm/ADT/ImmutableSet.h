@@ -221,7 +221,8 @@ private:
   Factory *factory;
   ImutAVLTree *left;
   ImutAVLTree *right;
-  ImutAVLTree *prev;
+  /// The next tree in the factory's canonicalization bucket. Buckets are
+  /// short, so they are singly linked to keep nodes small.
   ImutAVLTree *next;
 
   unsigned height         : 28;
@@ -242,7 +243,7 @@ private:
   ///   ImutAVLFactory.
   ImutAVLTree(Factory *f, ImutAVLTree* l, ImutAVLTree* r, value_type_ref v,
               unsigned height)
-    : factory(f), left(l), right(r), prev(0), next(0), height(height),
+    : factory(f), left(l), right(r), next(0), height(height),
       IsMutable(true), IsDigestCached(false), IsCanonicalized(0),
       value(v), digest(0), refCount(0)
   {
@@ -340,13 +341,11 @@ public:
     if (right)
       right->release();
     if (IsCanonicalized) {
-      if (next)
-        next->prev = prev;
-
-      if (prev)
-        prev->next = next;
-      else
-        factory->Cache[factory->maskCacheIndex(computeDigest())] = next;
+      ImutAVLTree **Link =
+          &factory->Cache[factory->maskCacheIndex(computeDigest())];
+      while (*Link != this)
+        Link = &(*Link)->next;
+      *Link = next;
     }
 
     // We need to clear the mutability bit in case we are
@@ -413,6 +412,10 @@ public:
 
   TreeTy* getEmptyTree() const { return NULL; }
 
+  /// Returns the number of bytes allocated for tree nodes, including nodes
+  /// that have been freed and are waiting to be reused.
+  size_t getTotalMemory() const { return getAllocator().getTotalMemory(); }
+
 protected:
 
   //===--------------------------------------------------===//
@@ -620,6 +623,10 @@ public:
       if (!entry)
         break;
       for (TreeTy *T = entry ; T != 0; T = T->next) {
+        // The bucket is indexed by a masked digest; trees whose full digests
+        // differ cannot have the same contents.
+        if (T->computeDigest() != digest)
+          continue;
         // Compare the Contents('T') with Contents('TNew')
         typename TreeTy::iterator TI = T->begin(), TE = T->end();
         if (!compareTreeWithSection(TNew, TI, TE))
@@ -631,7 +638,6 @@ public:
           TNew->destroy();
         return T;
       }
-      entry->prev = TNew;
       TNew->next = entry;
     }
     while (false);
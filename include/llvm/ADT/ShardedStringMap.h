@@ -0,0 +1,104 @@
+//===- llvm/ADT/ShardedStringMap.h - Concurrent StringMap -------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file defines ShardedStringMap, a StringMap that several threads can
+// insert into at once.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_ADT_SHARDEDSTRINGMAP_H
+#define LLVM_ADT_SHARDEDSTRINGMAP_H
+
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/Support/Allocator.h"
+#include "llvm/Support/Mutex.h"
+#include <utility>
+
+namespace llvm {
+
+/// ShardedStringMap - Splits its keys over \p NumShards StringMaps by hash,
+/// each with its own lock and its own BumpPtrAllocator arena, so threads
+/// inserting different keys rarely wait for each other. This is what a
+/// symbol table filled from several input files in parallel needs.
+///
+/// Entries are never freed or moved, so the references returned by insert
+/// and lookup stay valid until the map is destroyed, and the keys they hold
+/// can be used as interned strings. Values should be set through insert;
+/// mutating the value of an entry another thread can see needs outside
+/// synchronization.
+template <typename ValueTy, unsigned NumShards = 16>
+class ShardedStringMap {
+public:
+  typedef StringMapEntry<ValueTy> MapEntryTy;
+
+private:
+  struct Shard {
+    sys::Mutex Lock;
+    BumpPtrAllocator Alloc;
+    StringMap<ValueTy, BumpPtrAllocator &> Map;
+    Shard() : Lock(false), Map(Alloc) {}
+  };
+  Shard Shards[NumShards];
+
+  ShardedStringMap(const ShardedStringMap &) LLVM_DELETED_FUNCTION;
+  void operator=(const ShardedStringMap &) LLVM_DELETED_FUNCTION;
+
+  Shard &getShard(StringRef Key) {
+    // StringMap buckets on the low bits of the same hash, so pick the shard
+    // from the high bits to keep each shard's table evenly filled.
+    return Shards[(HashString(Key) >> 20) % NumShards];
+  }
+
+public:
+  ShardedStringMap() {}
+
+  /// insert - Insert \p Key with \p Val unless it is already present. Returns
+  /// the entry for \p Key and whether it was inserted.
+  std::pair<MapEntryTy *, bool> insert(StringRef Key, const ValueTy &Val) {
+    Shard &S = getShard(Key);
+    sys::ScopedLock Guard(S.Lock);
+    unsigned OldSize = S.Map.size();
+    MapEntryTy &E = S.Map.GetOrCreateValue(Key, Val);
+    return std::make_pair(&E, S.Map.size() != OldSize);
+  }
+
+  /// lookup - Return the entry for \p Key, or null if it is not present.
+  MapEntryTy *lookup(StringRef Key) {
+    Shard &S = getShard(Key);
+    sys::ScopedLock Guard(S.Lock);
+    typename StringMap<ValueTy, BumpPtrAllocator &>::iterator I =
+        S.Map.find(Key);
+    return I == S.Map.end() ? nullptr : &*I;
+  }
+
+  /// size - The number of entries. Only exact while no thread is inserting.
+  unsigned size() {
+    unsigned N = 0;
+    for (unsigned I = 0; I != NumShards; ++I) {
+      sys::ScopedLock Guard(Shards[I].Lock);
+      N += Shards[I].Map.size();
+    }
+    return N;
+  }
+
+  /// forEach - Call \p F on every entry, one shard at a time, in no
+  /// particular order. Must not be called while other threads insert.
+  template <typename FnTy> void forEach(FnTy F) {
+    for (unsigned I = 0; I != NumShards; ++I)
+      for (typename StringMap<ValueTy, BumpPtrAllocator &>::iterator
+               EI = Shards[I].Map.begin(), EE = Shards[I].Map.end();
+           EI != EE; ++EI)
+        F(*EI);
+  }
+};
+
+} // end namespace llvm
+
+#endif
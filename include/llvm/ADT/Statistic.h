@@ -32,14 +32,27 @@
 namespace llvm {
 class raw_ostream;
 
+/// Statistic - A named counter, printed by -stats.
+///
+/// Updates from several threads are safe. Registration gives each statistic
+/// a set of per-thread shards, one cache line apart, and increments, adds and
+/// subtractions go to the shard of the calling thread, so threads counting
+/// the same event do not contend for one word. Reading the value sums Value
+/// and the shards; it is exact once the threads updating it are done.
+/// Assignment, multiplication and division first fold the shards into Value,
+/// so they are only meaningful while no other thread updates the statistic.
 class Statistic {
 public:
   const char *Name;
   const char *Desc;
   volatile llvm::sys::cas_flag Value;
   bool Initialized;
+  /// Per-thread shards, allocated by RegisterStatistic. Null until then.
+  volatile llvm::sys::cas_flag *Shards;
 
-  llvm::sys::cas_flag getValue() const { return Value; }
+  llvm::sys::cas_flag getValue() const {
+    return Shards ? Value + sumShards() : Value;
+  }
   const char *getName() const { return Name; }
   const char *getDesc() const { return Desc; }
 
@@ -50,62 +63,70 @@ public:
   }
 
   // Allow use of this class as the value itself.
-  operator unsigned() const { return Value; }
+  operator unsigned() const { return getValue(); }
 
 #if !defined(NDEBUG) || defined(LLVM_ENABLE_STATS)
    const Statistic &operator=(unsigned Val) {
+    init();
+    foldShards();
     Value = Val;
-    return init();
+    return *this;
   }
 
+  // The returned values below are those of the calling thread's view of the
+  // statistic, which other threads may be updating.
   const Statistic &operator++() {
-    // FIXME: This function and all those that follow carefully use an
-    // atomic operation to update the value safely in the presence of
-    // concurrent accesses, but not to read the return value, so the
-    // return value is not thread safe.
-    sys::AtomicIncrement(&Value);
-    return init();
+    init();
+    sys::AtomicIncrement(getShard());
+    return *this;
   }
 
   unsigned operator++(int) {
     init();
-    unsigned OldValue = Value;
-    sys::AtomicIncrement(&Value);
+    unsigned OldValue = getValue();
+    sys::AtomicIncrement(getShard());
     return OldValue;
   }
 
   const Statistic &operator--() {
-    sys::AtomicDecrement(&Value);
-    return init();
+    init();
+    sys::AtomicDecrement(getShard());
+    return *this;
   }
 
   unsigned operator--(int) {
     init();
-    unsigned OldValue = Value;
-    sys::AtomicDecrement(&Value);
+    unsigned OldValue = getValue();
+    sys::AtomicDecrement(getShard());
     return OldValue;
   }
 
   const Statistic &operator+=(const unsigned &V) {
     if (!V) return *this;
-    sys::AtomicAdd(&Value, V);
-    return init();
+    init();
+    sys::AtomicAdd(getShard(), V);
+    return *this;
   }
 
   const Statistic &operator-=(const unsigned &V) {
     if (!V) return *this;
-    sys::AtomicAdd(&Value, -V);
-    return init();
+    init();
+    sys::AtomicAdd(getShard(), -V);
+    return *this;
   }
 
   const Statistic &operator*=(const unsigned &V) {
+    init();
+    foldShards();
     sys::AtomicMul(&Value, V);
-    return init();
+    return *this;
   }
 
   const Statistic &operator/=(const unsigned &V) {
+    init();
+    foldShards();
     sys::AtomicDiv(&Value, V);
-    return init();
+    return *this;
   }
 
 #else  // Statistics are disabled in release builds.
@@ -157,12 +178,20 @@ protected:
     return *this;
   }
   void RegisterStatistic();
+
+  /// getShard - The counter the calling thread updates: its shard, or Value
+  /// if shards could not be allocated.
+  volatile sys::cas_flag *getShard();
+  /// sumShards - The sum of the shards.
+  sys::cas_flag sumShards() const;
+  /// foldShards - Move the counts of the shards into Value.
+  void foldShards();
 };
 
 // STATISTIC - A macro to make definition of statistics really simple.  This
 // automatically passes the DEBUG_TYPE of the file into the statistic.
 #define STATISTIC(VARNAME, DESC) \
-  static llvm::Statistic VARNAME = { DEBUG_TYPE, DESC, 0, 0 }
+  static llvm::Statistic VARNAME = { DEBUG_TYPE, DESC, 0, 0, 0 }
 
 /// \brief Enable the collection and printing of statistics.
 void EnableStatistics();
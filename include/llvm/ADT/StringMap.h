@@ -216,6 +216,11 @@ public:
 /// keys that are "strings", which are basically ranges of bytes. This does some
 /// funky memory allocation and hashing things to make it extremely efficient,
 /// storing the string data *after* the value in the map.
+///
+/// Each entry is one allocation from AllocatorTy. When entries are rarely
+/// erased, as in symbol tables, use a BumpPtrAllocator reference so that the
+/// entries of one or several maps come from a shared arena and are released
+/// all at once with it (see UniqueStringSaver and ShardedStringMap).
 template<typename ValueTy, typename AllocatorTy = MallocAllocator>
 class StringMap : public StringMapImpl {
   AllocatorTy Allocator;
@@ -32,6 +32,8 @@ namespace InlineConstants {
   const int LastCallToStaticBonus = -15000;
   const int ColdccPenalty = 2000;
   const int NoreturnPenalty = 10000;
+  /// The threshold for call sites that profile data shows to be hot.
+  const int HotCallSiteThreshold = 3000;
   /// Do not inline functions which allocate this many bytes on the stack
   /// when the caller is recursive.
   const unsigned TotalAllocaSizeRecursiveCaller = 1024;
@@ -0,0 +1,262 @@
+//===- llvm/Analysis/MemorySSA.h - SSA form for memory ----------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file defines the MemorySSA analysis, which builds use-def chains for
+// memory once per function so that clobber queries do not have to scan
+// backwards through instructions the way MemoryDependenceAnalysis does.
+//
+// Every instruction that may write memory is a MemoryDef, every instruction
+// that may only read it is a MemoryUse, and blocks where different memory
+// states meet get a MemoryPhi. All of memory is treated as a single variable,
+// so each access has exactly one defining access:
+//
+//   ; 1 = MemoryDef(liveOnEntry)
+//   store i32 0, i32* %a
+//   ; 2 = MemoryDef(1)
+//   store i32 1, i32* %b
+//   ; MemoryUse(2)
+//   %x = load i32* %a
+//
+// The defining access is only the nearest possible clobber. The walker
+// (getClobberingAccess) then skips defs that alias analysis proves do not
+// clobber the queried location (store 2 above, for the load of %a) and
+// caches what it finds, so each query costs amortized time proportional to
+// the defs it skips rather than to the instructions between the two.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_ANALYSIS_MEMORYSSA_H
+#define LLVM_ANALYSIS_MEMORYSSA_H
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Analysis/AliasAnalysis.h"
+#include "llvm/Pass.h"
+#include "llvm/Support/Allocator.h"
+
+namespace llvm {
+
+class BasicBlock;
+class DominatorTree;
+class Function;
+class Instruction;
+class raw_ostream;
+
+/// MemoryAccess - A MemoryDef, MemoryUse or MemoryPhi.
+class MemoryAccess {
+public:
+  enum AccessKind { MemoryUseKind, MemoryDefKind, MemoryPhiKind };
+
+private:
+  AccessKind Kind;
+  BasicBlock *Block;
+
+protected:
+  MemoryAccess(AccessKind Kind, BasicBlock *BB) : Kind(Kind), Block(BB) {}
+
+public:
+  AccessKind getKind() const { return Kind; }
+  BasicBlock *getBlock() const { return Block; }
+
+  void print(raw_ostream &OS) const;
+};
+
+/// MemoryUseOrDef - An access made by an instruction.
+class MemoryUseOrDef : public MemoryAccess {
+  Instruction *MemoryInst;
+  MemoryAccess *DefiningAccess;
+
+  friend class MemorySSA;
+
+protected:
+  MemoryUseOrDef(AccessKind Kind, Instruction *MI, MemoryAccess *Def,
+                 BasicBlock *BB)
+    : MemoryAccess(Kind, BB), MemoryInst(MI), DefiningAccess(Def) {}
+
+public:
+  /// getMemoryInst - The instruction making the access, or null for the
+  /// live-on-entry def.
+  Instruction *getMemoryInst() const { return MemoryInst; }
+
+  /// getDefiningAccess - The nearest MemoryDef or MemoryPhi that dominates
+  /// this access. It may not clobber the locations this access touches.
+  MemoryAccess *getDefiningAccess() const { return DefiningAccess; }
+
+  static bool classof(const MemoryAccess *MA) {
+    return MA->getKind() != MemoryPhiKind;
+  }
+};
+
+/// MemoryUse - An instruction that may read memory but does not write it.
+class MemoryUse : public MemoryUseOrDef {
+public:
+  MemoryUse(Instruction *MI, MemoryAccess *Def, BasicBlock *BB)
+    : MemoryUseOrDef(MemoryUseKind, MI, Def, BB) {}
+
+  static bool classof(const MemoryAccess *MA) {
+    return MA->getKind() == MemoryUseKind;
+  }
+};
+
+/// MemoryDef - An instruction that may write memory, creating a new version
+/// of it.
+class MemoryDef : public MemoryUseOrDef {
+  unsigned ID;
+
+public:
+  MemoryDef(Instruction *MI, MemoryAccess *Def, BasicBlock *BB, unsigned ID)
+    : MemoryUseOrDef(MemoryDefKind, MI, Def, BB), ID(ID) {}
+
+  /// getID - The version number of the memory state this def creates, used
+  /// when printing. The live-on-entry def is 0.
+  unsigned getID() const { return ID; }
+
+  static bool classof(const MemoryAccess *MA) {
+    return MA->getKind() == MemoryDefKind;
+  }
+};
+
+/// MemoryPhi - The memory state at the start of a block reached by different
+/// states along different predecessors.
+class MemoryPhi : public MemoryAccess {
+  unsigned ID;
+  SmallVector<std::pair<BasicBlock *, MemoryAccess *>, 4> Incoming;
+
+  friend class MemorySSA;
+
+public:
+  MemoryPhi(BasicBlock *BB, unsigned ID)
+    : MemoryAccess(MemoryPhiKind, BB), ID(ID) {}
+
+  unsigned getID() const { return ID; }
+  unsigned getNumIncomingValues() const { return Incoming.size(); }
+  BasicBlock *getIncomingBlock(unsigned I) const { return Incoming[I].first; }
+  MemoryAccess *getIncomingValue(unsigned I) const {
+    return Incoming[I].second;
+  }
+
+  static bool classof(const MemoryAccess *MA) {
+    return MA->getKind() == MemoryPhiKind;
+  }
+};
+
+/// MemorySSA - The memory SSA form of one function.
+///
+/// Building it costs one walk over the instructions to create the accesses
+/// and one placement of MemoryPhis at the iterated dominance frontier of the
+/// blocks that contain defs, the same as promoting a single alloca to SSA.
+/// Transformations that move, add or remove memory instructions must either
+/// keep the form up to date through the update functions below or stop using
+/// it; it is not rebuilt behind their back.
+class MemorySSA {
+  AliasAnalysis *AA;
+  DominatorTree *DT;
+  Function &F;
+
+  BumpPtrAllocator Allocator;
+  DenseMap<const Instruction *, MemoryUseOrDef *> InstructionToAccess;
+  DenseMap<const BasicBlock *, MemoryPhi *> BlockToPhi;
+  MemoryDef *LiveOnEntryDef;
+  unsigned NextID;
+
+  /// Clobber query results: the access and the location it was asked for.
+  typedef std::pair<const MemoryAccess *, AliasAnalysis::Location> QueryKey;
+  struct QueryKeyInfo {
+    static QueryKey getEmptyKey() {
+      return QueryKey(DenseMapInfo<const MemoryAccess *>::getEmptyKey(),
+                      AliasAnalysis::Location());
+    }
+    static QueryKey getTombstoneKey() {
+      return QueryKey(DenseMapInfo<const MemoryAccess *>::getTombstoneKey(),
+                      AliasAnalysis::Location());
+    }
+    static unsigned getHashValue(const QueryKey &K) {
+      return DenseMapInfo<const MemoryAccess *>::getHashValue(K.first) ^
+             DenseMapInfo<const Value *>::getHashValue(K.second.Ptr) ^
+             (unsigned)K.second.Size;
+    }
+    static bool isEqual(const QueryKey &LHS, const QueryKey &RHS) {
+      return LHS.first == RHS.first && LHS.second.Ptr == RHS.second.Ptr &&
+             LHS.second.Size == RHS.second.Size &&
+             LHS.second.TBAATag == RHS.second.TBAATag;
+    }
+  };
+  DenseMap<QueryKey, MemoryAccess *, QueryKeyInfo> ClobberCache;
+
+  MemorySSA(const MemorySSA &) LLVM_DELETED_FUNCTION;
+  void operator=(const MemorySSA &) LLVM_DELETED_FUNCTION;
+
+  void buildMemorySSA();
+  MemoryAccess *getClobberingAccess(MemoryAccess *Start,
+                                    const AliasAnalysis::Location &Loc,
+                                    Instruction *QueryInst);
+
+public:
+  MemorySSA(Function &F, AliasAnalysis *AA, DominatorTree *DT);
+  ~MemorySSA();
+
+  /// getMemoryAccess - The access made by \p I, or null if \p I does not
+  /// touch memory.
+  MemoryUseOrDef *getMemoryAccess(const Instruction *I) const {
+    return InstructionToAccess.lookup(I);
+  }
+
+  /// getMemoryAccess - The MemoryPhi at the start of \p BB, if any.
+  MemoryPhi *getMemoryAccess(const BasicBlock *BB) const {
+    return BlockToPhi.lookup(BB);
+  }
+
+  /// getLiveOnEntryDef - The def standing for the memory state on entry to
+  /// the function. A clobber query answering it means nothing in the
+  /// function clobbers the location.
+  MemoryDef *getLiveOnEntryDef() const { return LiveOnEntryDef; }
+  bool isLiveOnEntryDef(const MemoryAccess *MA) const {
+    return MA == LiveOnEntryDef;
+  }
+
+  /// getClobberingAccess - The nearest access that may clobber the location
+  /// \p I reads or writes: a MemoryDef that aliases it, a MemoryPhi whose
+  /// incoming states are clobbered differently, or the live-on-entry def.
+  /// This is the query GVN, DSE and LICM ask MemoryDependenceAnalysis today.
+  MemoryAccess *getClobberingAccess(Instruction *I);
+
+  /// removeMemoryAccess - Forget the access of \p I, which is about to be
+  /// erased. Its users are redirected to its defining access and cached
+  /// clobber results that mention it are dropped.
+  void removeMemoryAccess(Instruction *I);
+
+  /// dominates - Whether access \p A dominates access \p B.
+  bool dominates(const MemoryAccess *A, const MemoryAccess *B) const;
+
+  void print(raw_ostream &OS) const;
+  void verifyMemorySSA() const;
+};
+
+/// MemorySSAWrapperPass - Builds MemorySSA for the legacy pass manager.
+/// Preserving it is only legal for passes that update it.
+class MemorySSAWrapperPass : public FunctionPass {
+  MemorySSA *MSSA;
+
+public:
+  static char ID;
+  MemorySSAWrapperPass();
+  ~MemorySSAWrapperPass();
+
+  MemorySSA &getMSSA() { return *MSSA; }
+
+  bool runOnFunction(Function &F) override;
+  void releaseMemory() override;
+  void getAnalysisUsage(AnalysisUsage &AU) const override;
+  void verifyAnalysis() const override;
+  void print(raw_ostream &OS, const Module *M) const override;
+};
+
+} // End llvm namespace
+
+#endif
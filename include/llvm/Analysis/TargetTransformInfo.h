@@ -222,6 +222,16 @@ public:
     /// loop body even when the number of loop iterations is not known at compile
     /// time).
     bool     Runtime;
+    /// Cap the unrolling factor so that the values live across the loop
+    /// body, counted once per unrolled copy, fit in the registers reported
+    /// by getNumberOfRegisters. This avoids the spills aggressive unrolling
+    /// causes on targets with few registers. It does not apply when the
+    /// loop is being fully unrolled.
+    bool     LimitByRegisterPressure;
+    /// Allow unroll-and-jam: unroll the outer loop of a two-deep nest and
+    /// fuse the copies of the inner loop, when the inner trip count does not
+    /// depend on the outer induction variable and no dependence is reversed.
+    bool     UnrollAndJam;
   };
 
   /// \brief Get target-customized preferences for the generic loop unrolling
@@ -381,6 +391,25 @@ public:
                                    unsigned Alignment,
                                    unsigned AddressSpace) const;
 
+  /// \return The largest interleave factor for which the target has
+  /// structure load and store instructions (2, 3 and 4 for NEON's vldN and
+  /// vstN), or 0 if interleaved accesses must be built from shuffles.
+  virtual unsigned getMaxInterleaveFactor() const;
+
+  /// \return The cost of an interleaved load or store: \p Factor accesses
+  /// with consecutive element offsets, such as the R, G, B and A channels of
+  /// a pixel loop, vectorized together as one wide access of \p VecTy and
+  /// split (or merged) into the \p Indices members actually used.
+  ///
+  /// \p Opcode is Instruction::Load or Instruction::Store. A group that is
+  /// not supported natively costs the wide access plus the shuffles needed to
+  /// separate its members.
+  virtual unsigned getInterleavedMemoryOpCost(unsigned Opcode, Type *VecTy,
+                                              unsigned Factor,
+                                              ArrayRef<unsigned> Indices,
+                                              unsigned Alignment,
+                                              unsigned AddressSpace) const;
+
   /// \brief Calculate the cost of performing a vector reduction.
   ///
   /// This is the cost of reducing the vector value of type \p Ty to a scalar
@@ -397,6 +426,14 @@ public:
   virtual unsigned getReductionCost(unsigned Opcode, Type *Ty,
                                     bool IsPairwiseForm) const;
 
+  /// \returns The cost of reducing the vector value of type \p Ty to its
+  /// minimum or maximum element, as a tree of icmp/fcmp and select
+  /// instructions in the pairwise or split form described above. Targets
+  /// with pairwise min/max instructions, such as NEON's vpmin and vpmax,
+  /// make the pairwise form cheap.
+  virtual unsigned getMinMaxReductionCost(Type *Ty, bool IsUnsigned,
+                                          bool IsPairwiseForm) const;
+
   /// \returns The cost of Intrinsic instructions.
   virtual unsigned getIntrinsicInstrCost(Intrinsic::ID ID, Type *RetTy,
                                          ArrayRef<Type *> Tys) const;
@@ -470,13 +470,17 @@ public:
 
   /// SkipBlock - Having read the ENTER_SUBBLOCK abbrevid and a BlockID, skip
   /// over the body of this block.  If the block record is malformed, return
-  /// true.
-  bool SkipBlock() {
+  /// true.  If NumWordsP is non-null, the size of the body in 32-bit words is
+  /// stored there, so block sizes can be tallied without reading the records
+  /// inside.
+  bool SkipBlock(unsigned *NumWordsP = nullptr) {
     // Read and ignore the codelen value.  Since we are skipping this block, we
     // don't care what code widths are used inside of it.
     ReadVBR(bitc::CodeLenWidth);
     SkipToFourByteBoundary();
     unsigned NumFourBytes = Read(bitc::BlockSizeWidth);
+    if (NumWordsP)
+      *NumWordsP = NumFourBytes;
 
     // Check that the block wasn't partially defined, and that the offset isn't
     // bogus.
@@ -71,7 +71,14 @@ namespace bitc {
     // MODULE_CODE_PURGEVALS: [numvals]
     MODULE_CODE_PURGEVALS   = 10,
 
-    MODULE_CODE_GCNAME      = 11   // GCNAME: [strchr x N]
+    MODULE_CODE_GCNAME      = 11,  // GCNAME: [strchr x N]
+
+    // FNOFFSETS: [offset x N]
+    // The 32-bit word offset, from the start of the identification of the
+    // module block, of the body block of each function with a body, in the
+    // order of the FUNCTION records. Emitted before the first function block
+    // so readers can materialize any function without scanning the others.
+    MODULE_CODE_FNOFFSETS   = 12
   };
 
   /// PARAMATTR blocks have code for defining a parameter attribute set.
@@ -60,6 +60,14 @@ namespace llvm {
   /// should be in "binary" mode.
   void WriteBitcodeToFile(const Module *M, raw_ostream &Out);
 
+  /// WriteBitcodeToFile - As above, but encode the function blocks on
+  /// \p Threads threads. Each function block is written into its own buffer
+  /// with the value numbering of the module, which is computed first, and the
+  /// buffers are spliced into \p Out in module order behind a FNOFFSETS
+  /// record. The output is identical for any number of threads.
+  void WriteBitcodeToFile(const Module *M, raw_ostream &Out,
+                          unsigned Threads);
+
 
   /// isBitcodeWrapper - Return true if the given bytes are the magic bytes
   /// for an LLVM IR bitcode wrapper.
@@ -16,6 +16,7 @@
 #define LLVM_CODEGEN_FASTISEL_H
 
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/CodeGen/MachineBasicBlock.h"
 
 namespace llvm {
@@ -24,6 +25,7 @@ class AllocaInst;
 class Constant;
 class ConstantFP;
 class DataLayout;
+class Function;
 class FunctionLoweringInfo;
 class Instruction;
 class LoadInst;
@@ -41,6 +43,7 @@ class TargetRegisterClass;
 class TargetRegisterInfo;
 class User;
 class Value;
+class raw_ostream;
 
 /// This is a fast-path instruction selection class that generates poor code and
 /// doesn't support illegal types or non-trivial lowering, but runs quickly.
@@ -413,6 +416,33 @@ private:
   bool hasTrivialKill(const Value *V) const;
 };
 
+/// Records the instructions that FastISel could not select and handed over to
+/// SelectionDAG, for -fast-isel-stats.
+///
+/// Fallbacks are bucketed by a short description of the instruction: its
+/// opcode name, except that calls are described by their callee ("call
+/// objc_msgSend", "call llvm.memcpy.p0i8.p0i8.i32", "call <indirect>"), since
+/// those are the most common cause and the fix depends on which callee it is.
+class FastISelFallbackStats {
+  StringMap<unsigned> FunctionCounts;
+  StringMap<unsigned> TotalCounts;
+  unsigned NumFunctions;
+  unsigned NumFunctionsWithFallbacks;
+
+public:
+  FastISelFallbackStats() : NumFunctions(0), NumFunctionsWithFallbacks(0) {}
+
+  /// Note that FastISel failed to select \p I.
+  void recordFallback(const Instruction *I);
+
+  /// Print the fallbacks recorded for \p F, if any, to \p OS and start
+  /// counting for the next function.
+  void finishFunction(const Function &F, raw_ostream &OS);
+
+  /// Print the totals over all functions, most frequent first.
+  void print(raw_ostream &OS) const;
+};
+
 }
 
 #endif
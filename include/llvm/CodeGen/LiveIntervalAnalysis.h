@@ -21,6 +21,7 @@
 #define LLVM_CODEGEN_LIVEINTERVAL_ANALYSIS_H
 
 #include "llvm/ADT/IndexedMap.h"
+#include "llvm/ADT/SetVector.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/CodeGen/LiveInterval.h"
 #include "llvm/CodeGen/MachineBasicBlock.h"
@@ -95,6 +96,10 @@ namespace llvm {
     /// interference.
     SmallVector<LiveRange*, 0> RegUnitRanges;
 
+    /// Virtual registers whose intervals are stale after code changes reported
+    /// through markIntervalDirty, in the order they were reported.
+    SmallSetVector<unsigned, 16> DirtyVRegs;
+
   public:
     static char ID; // Pass identification, replacement for typeid
     LiveIntervals();
@@ -296,6 +301,44 @@ namespace llvm {
     void handleMoveIntoBundle(MachineInstr* MI, MachineInstr* BundleStart,
                               bool UpdateFlags = false);
 
+    /// handleInsertedInstr - Notify LiveIntervals that \p MI was just inserted
+    /// into a block.  \p MI is given a SlotIndex, which renumbers only the
+    /// neighbouring indexes, and the intervals of its virtual register
+    /// operands are marked dirty.
+    SlotIndex handleInsertedInstr(MachineInstr *MI);
+
+    /// handleRemovedInstr - Notify LiveIntervals that \p MI is about to be
+    /// erased.  Its index is released and the intervals of its virtual
+    /// register operands are marked dirty.  Call this before erasing \p MI,
+    /// while its operands can still be read.
+    void handleRemovedInstr(MachineInstr *MI);
+
+    /// markIntervalDirty - Record that instructions defining or using \p Reg
+    /// were inserted, removed or rewritten without updating its interval.
+    void markIntervalDirty(unsigned Reg) {
+      if (TargetRegisterInfo::isVirtualRegister(Reg) && hasInterval(Reg))
+        DirtyVRegs.insert(Reg);
+    }
+
+    /// hasDirtyIntervals - Return true if some interval is awaiting
+    /// updateDirtyIntervals.
+    bool hasDirtyIntervals() const { return !DirtyVRegs.empty(); }
+
+    /// updateDirtyIntervals - Bring every interval marked dirty up to date.
+    ///
+    /// Each interval is rebuilt from its register's remaining defs and uses
+    /// with LiveRangeCalc, which only visits the blocks the register is live
+    /// in. Nothing else in the function is rescanned, and SlotIndexes is
+    /// never renumbered wholesale. This makes a batch of edits cost
+    /// O(registers touched) rather than O(instructions in the range). Passes
+    /// that rewrite many instructions at once (LiveRangeEdit,
+    /// the machine scheduler, TwoAddressInstructionPass) should report each
+    /// edit through handleInsertedInstr, handleRemovedInstr or
+    /// markIntervalDirty, and call this once before next querying liveness.
+    ///
+    /// Dead defs left behind are added to \p Dead if it is given.
+    void updateDirtyIntervals(SmallVectorImpl<MachineInstr*> *Dead = nullptr);
+
     /// repairIntervalsInRange - Update live intervals for instructions in a
     /// range of iterators. It is intended for use after target hooks that may
     /// insert or remove instructions, and is only efficient for a small number
@@ -58,6 +58,12 @@ class LiveRegMatrix : public MachineFunctionPass {
   unsigned RegMaskVirtReg;
   BitVector RegMaskUsable;
 
+  // Interference queries answered for the current function, and the number
+  // after which the allocator should switch to a cheaper strategy (0 means
+  // no limit).
+  unsigned NumQueries;
+  unsigned QueryBudget;
+
   // MachineFunctionPass boilerplate.
   void getAnalysisUsage(AnalysisUsage&) const override;
   bool runOnMachineFunction(MachineFunction&) override;
@@ -138,6 +144,26 @@ public:
   /// valid until the next query() call.
   LiveIntervalUnion::Query &query(LiveInterval &VirtReg, unsigned RegUnit);
 
+  //===--------------------------------------------------------------------===//
+  // Compile time budget.
+  //===--------------------------------------------------------------------===//
+  //
+  // checkInterference() and query() are where an allocator spends its time on
+  // pathological functions, so they are what the budget counts. Both counts
+  // are reset for every function.
+  //
+
+  /// Limit the interference queries for the current function to Budget.
+  /// A budget of 0 removes the limit.
+  void setQueryBudget(unsigned Budget) { QueryBudget = Budget; }
+
+  /// Return the number of interference queries answered so far.
+  unsigned getNumQueries() const { return NumQueries; }
+
+  /// Return true once more queries than the budget allows were answered.
+  /// The matrix keeps answering them; it is up to the allocator to stop.
+  bool isOverBudget() const { return QueryBudget && NumQueries > QueryBudget; }
+
   /// Directly access the live interval unions per regunit.
   /// This returns an array indexed by the regunit number.
   LiveIntervalUnion *getLiveUnions() { return &Matrix[0]; }
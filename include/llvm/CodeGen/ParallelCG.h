@@ -0,0 +1,56 @@
+//===-- llvm/CodeGen/ParallelCG.h - Parallel code generation ----*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This header declares an API for running the code generator on several
+// threads at once.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CODEGEN_PARALLELCG_H
+#define LLVM_CODEGEN_PARALLELCG_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/Target/TargetMachine.h"
+#include <functional>
+#include <memory>
+
+namespace llvm {
+
+class Module;
+class raw_ostream;
+
+/// splitCodeGen - Split \p M into OSs.size() partitions and run the code
+/// generator on each partition on its own thread, writing the output for
+/// partition I to *OSs[I].
+///
+/// The code generator keeps per-module state that is not thread safe (the
+/// LLVMContext that ISel creates constants in, the MCContext that owns every
+/// symbol, MachineModuleInfo), so threads cannot share one pass pipeline.
+/// Instead each partition is a copy of the functions assigned to it, moved
+/// into a fresh LLVMContext, and gets its own TargetMachine from
+/// \p TMFactory; ISel, scheduling, register allocation and emission then
+/// proceed exactly as for a single module.
+///
+/// Functions are assigned whole: the partition of a function is chosen to
+/// balance instruction counts, and callers and callees of internal functions
+/// are kept together where possible. Internal globals referenced from more
+/// than one partition are given hidden visibility and external linkage,
+/// renamed to stay unique, so the partitions link together into the same
+/// program. The relative order of functions within a partition is that of
+/// \p M.
+///
+/// \returns false on success. If \p OSs has one element, \p M is compiled
+/// directly on the calling thread.
+bool splitCodeGen(Module &M, ArrayRef<raw_ostream *> OSs,
+                  const std::function<TargetMachine *()> &TMFactory,
+                  TargetMachine::CodeGenFileType FileType);
+
+} // end namespace llvm
+
+#endif
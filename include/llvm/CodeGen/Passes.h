@@ -23,6 +23,7 @@ namespace llvm {
 
 class FunctionPass;
 class MachineFunctionPass;
+class ModulePass;
 class PassConfigImpl;
 class PassInfo;
 class ScheduleDAGInstrs;
@@ -417,6 +418,10 @@ namespace llvm {
   /// PostMachineScheduler - This pass schedules machine instructions postRA.
   extern char &PostMachineSchedulerID;
 
+  /// MachinePipeliner - This pass modulo schedules innermost single-block
+  /// loops, overlapping iterations and emitting their prologue and epilogue.
+  extern char &MachinePipelinerID;
+
   /// SpillPlacement analysis. Suggest optimal placement of spill code between
   /// basic blocks.
   extern char &SpillPlacementID;
@@ -445,6 +450,13 @@ namespace llvm {
   /// Greedy register allocation pass - This pass implements a global register
   /// allocator for optimized builds.
   ///
+  /// With -regalloc-work-budget=N, the allocator gives up on eviction and
+  /// region splitting for a function once its LiveRegMatrix has answered N
+  /// interference queries, and assigns or spills the remaining live ranges
+  /// in priority order as the basic allocator does. Functions that degrade
+  /// are counted in the "regalloc" statistics and the remaining work is
+  /// timed as "Greedy budget fallback" under -time-passes.
+  ///
   FunctionPass *createGreedyRegisterAllocator();
 
   /// PBQPRegisterAllocation Pass - This pass implements the Partitioned Boolean
@@ -587,6 +599,22 @@ namespace llvm {
   /// the intrinsic for later emission to the StackMap.
   extern char &StackMapLivenessID;
 
+  /// createInterleavedAccessPass - This pass matches the wide loads and stores
+  /// with strided shufflevectors that the loop vectorizer emits for
+  /// interleaved accesses, and hands them to
+  /// TargetLowering::lowerInterleavedLoad/Store so they become structure
+  /// memory operations rather than shuffle sequences.
+  FunctionPass *createInterleavedAccessPass(const TargetMachine *TM);
+
+  /// createMachineOutlinerPass - This pass finds instruction sequences that
+  /// occur more than once across the functions of a module, using a suffix
+  /// tree over the instructions mapped to integers, and replaces them with
+  /// calls to new shared functions where the TargetInstrInfo outliner hooks
+  /// say the code size saved exceeds the call and frame overhead. It runs
+  /// after register allocation and block placement, and reports the bytes it
+  /// saved in its statistics.
+  ModulePass *createMachineOutlinerPass();
+
 } // End llvm namespace
 
 #endif
@@ -20,6 +20,7 @@
 #include "llvm/ADT/ilist.h"
 #include "llvm/CodeGen/DAGCombine.h"
 #include "llvm/CodeGen/SelectionDAGNodes.h"
+#include "llvm/Support/ArrayRecycler.h"
 #include "llvm/Support/RecyclingAllocator.h"
 #include "llvm/Target/TargetMachine.h"
 #include <cassert>
@@ -76,6 +77,26 @@ template<> struct FoldingSetTrait<SDVTListNode> : DefaultFoldingSetTrait<SDVTLis
   }
 };
 
+// Specialize FoldingSetTrait for SDNode so that lookups in the CSE map reject
+// bucket entries by the hash cached in SDNode::CSEHash before profiling them.
+// SelectionDAG refreshes the cached hash on every insertion into the map
+// (insertIntoCSEMap, getOrInsertIntoCSEMap). Rehashing the map when it grows
+// recomputes the hash from the node's profile, so it never depends on the
+// cache.
+template<> struct FoldingSetTrait<SDNode> : DefaultFoldingSetTrait<SDNode> {
+  static bool Equals(const SDNode &X, const FoldingSetNodeID &ID,
+                     unsigned IDHash, FoldingSetNodeID &TempID) {
+    if (X.CSEHash != IDHash)
+      return false;
+    X.Profile(TempID);
+    return TempID == ID;
+  }
+  static unsigned ComputeHash(const SDNode &X, FoldingSetNodeID &TempID) {
+    X.Profile(TempID);
+    return TempID.ComputeHash();
+  }
+};
+
 template<> struct ilist_traits<SDNode> : public ilist_default_traits<SDNode> {
 private:
   mutable ilist_half_node<SDNode> Sentinel;
@@ -198,6 +219,12 @@ class SelectionDAG {
   /// OperandAllocator - Pool allocation for machine-opcode SDNode operands.
   BumpPtrAllocator OperandAllocator;
 
+  /// OperandRecycler - Recycles the operand arrays of nodes with more operands
+  /// than their SDNode subclass stores inline, drawing on OperandAllocator.
+  /// Arrays are bucketed by power-of-two capacity, so a deleted node's
+  /// operands are reused by the next node of similar size.
+  ArrayRecycler<SDUse> OperandRecycler;
+
   /// Allocator - Pool allocation for misc. objects that are created once per
   /// SelectionDAG.
   BumpPtrAllocator Allocator;
@@ -1174,6 +1201,37 @@ private:
                                void *&InsertPos);
   SDNode *UpdadeSDLocOnMergedSDNode(SDNode *N, SDLoc loc);
 
+  /// allocateOperands - Return storage for \p NumOps operands from
+  /// OperandRecycler.  DeallocateNode returns it.
+  SDUse *allocateOperands(unsigned NumOps) {
+    return OperandRecycler.allocate(
+        ArrayRecycler<SDUse>::Capacity::get(NumOps), OperandAllocator);
+  }
+
+  /// insertIntoCSEMap - Record the hash of \p ID in \p N and add \p N to the
+  /// CSE map at \p InsertPos, as found by a failed lookup of \p ID.
+  void insertIntoCSEMap(SDNode *N, const FoldingSetNodeID &ID,
+                        void *InsertPos) {
+    N->CSEHash = ID.ComputeHash();
+    CSEMap.InsertNode(N, InsertPos);
+  }
+
+  /// getOrInsertIntoCSEMap - Return the node in the CSE map that is equal to
+  /// \p N, or record the hash of \p N's current profile in it and add it to
+  /// the map if there is none. This is how a node whose operands or opcode
+  /// changed goes back into the map; CSEMap.GetOrInsertNode and
+  /// CSEMap.InsertNode must not be used directly, as they would leave a
+  /// stale CSEHash behind.
+  SDNode *getOrInsertIntoCSEMap(SDNode *N) {
+    FoldingSetNodeID ID;
+    N->Profile(ID);
+    void *InsertPos;
+    if (SDNode *Existing = CSEMap.FindNodeOrInsertPos(ID, InsertPos))
+      return Existing;
+    insertIntoCSEMap(N, ID, InsertPos);
+    return N;
+  }
+
   void DeleteNodeNotInCSEMaps(SDNode *N);
   void DeallocateNode(SDNode *N);
 
@@ -22,6 +22,7 @@
 
 namespace llvm {
   class FastISel;
+  class FastISelFallbackStats;
   class SelectionDAGBuilder;
   class SDValue;
   class MachineRegisterInfo;
@@ -258,9 +259,22 @@ private:
   /// \brief Perform instruction selection on a single basic block, for
   /// instructions between \p Begin and \p End.  \p HadTailCall will be set
   /// to true if a call in the block was translated as a tail call.
+  ///
+  /// Blocks with more instructions than -dag-max-block-size are built and
+  /// selected as several DAGs, ending each at the first instruction past the
+  /// limit that is not part of a glued sequence (see findDAGSplitPoint).
+  /// Values defined before a split point and used after it are exported to
+  /// virtual registers, exactly as for values used in other blocks.
   void SelectBasicBlock(BasicBlock::const_iterator Begin,
                         BasicBlock::const_iterator End,
                         bool &HadTailCall);
+
+  /// \brief Return the point at or after \p Start, and before \p End, at
+  /// which the DAG for a very large block may be cut, or \p End if there is
+  /// none.  Calls, their argument setup, and instructions used by a
+  /// terminator are never separated from one another.
+  BasicBlock::const_iterator findDAGSplitPoint(BasicBlock::const_iterator Start,
+                                               BasicBlock::const_iterator End);
   void FinishBasicBlock();
 
   void CodeGenAndEmitDAG();
@@ -281,6 +295,11 @@ private:
   /// state machines that start with a OPC_SwitchOpcode node.
   std::vector<unsigned> OpcodeOffset;
 
+  /// FallbackStats - The instructions FastISel handed back to SelectionDAG,
+  /// per function and in total. Only allocated under -fast-isel-stats; the
+  /// totals are printed when the pass is destroyed.
+  FastISelFallbackStats *FallbackStats;
+
   void UpdateChainsAndGlue(SDNode *NodeToMatch, SDValue InputChain,
                            const SmallVectorImpl<SDNode*> &ChainNodesMatched,
                            SDValue InputGlue, const SmallVectorImpl<SDNode*> &F,
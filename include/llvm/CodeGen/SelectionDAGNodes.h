@@ -360,11 +360,17 @@ private:
   // this ordering.
   unsigned IROrder;
 
+  /// CSEHash - The hash of this node's FoldingSetNodeID, recorded each time
+  /// it is added to the CSE map so that mismatched bucket entries are
+  /// rejected without walking their operand lists.
+  unsigned CSEHash;
+
   /// getValueTypeList - Return a pointer to the specified value type.
   static const EVT *getValueTypeList(EVT VT);
 
   friend class SelectionDAG;
   friend struct ilist_traits<SDNode>;
+  friend struct FoldingSetTrait<SDNode>;
 
 public:
   //===--------------------------------------------------------------------===//
@@ -721,7 +727,7 @@ protected:
       OperandList(NumOps ? new SDUse[NumOps] : nullptr),
       ValueList(VTs.VTs), UseList(nullptr),
       NumOperands(NumOps), NumValues(VTs.NumVTs),
-      debugLoc(dl), IROrder(Order) {
+      debugLoc(dl), IROrder(Order), CSEHash(0) {
     for (unsigned i = 0; i != NumOps; ++i) {
       OperandList[i].setUser(this);
       OperandList[i].setInitial(Ops[i]);
@@ -729,13 +735,26 @@ protected:
     checkForCycles(this);
   }
 
+  /// This constructor takes its operand storage from \p Storage, which must
+  /// have room for \p NumOps operands and outlive the node.  SelectionDAG
+  /// uses it to place variadic operand lists in its OperandRecycler rather
+  /// than giving every such node its own heap allocation.
+  SDNode(unsigned Opc, unsigned Order, const DebugLoc dl, SDVTList VTs,
+         SDUse *Storage, const SDValue *Ops, unsigned NumOps)
+    : NodeType(Opc), OperandsNeedDelete(false), HasDebugValue(false),
+      SubclassData(0), NodeId(-1), OperandList(nullptr), ValueList(VTs.VTs),
+      UseList(nullptr), NumOperands(0), NumValues(VTs.NumVTs), debugLoc(dl),
+      IROrder(Order), CSEHash(0) {
+    InitOperands(Storage, Ops, NumOps);
+  }
+
   /// This constructor adds no operands itself; operands can be
   /// set later with InitOperands.
   SDNode(unsigned Opc, unsigned Order, const DebugLoc dl, SDVTList VTs)
     : NodeType(Opc), OperandsNeedDelete(false), HasDebugValue(false),
       SubclassData(0), NodeId(-1), OperandList(nullptr), ValueList(VTs.VTs),
       UseList(nullptr), NumOperands(0), NumValues(VTs.NumVTs), debugLoc(dl),
-      IROrder(Order) {}
+      IROrder(Order), CSEHash(0) {}
 
   /// InitOperands - Initialize the operands list of this with 1 operand.
   void InitOperands(SDUse *Ops, const SDValue &Op0) {
@@ -90,6 +90,9 @@ public:
 
   bool isSectionAtomizableBySymbols(const MCSection &Section) const override;
 
+  /// Functions marked cold, e.g. by profile-guided optimization for never
+  /// executed functions, go in __TEXT,__text_cold when
+  /// TargetOptions::ColdFunctionSection is set.
   const MCSection *
     SelectSectionForGlobal(const GlobalValue *GV,
                            SectionKind Kind, Mangler &Mang,
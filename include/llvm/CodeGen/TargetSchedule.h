@@ -168,6 +168,14 @@ public:
   unsigned computeInstrLatency(const MachineInstr *MI,
                                bool UseDefaultDefLatency = true) const;
 
+  /// \brief Compute the reciprocal throughput of this instruction: the number
+  /// of cycles that independent copies of it occupy the machine on average.
+  ///
+  /// Uses the machine model if present (see
+  /// MCSchedModel::getReciprocalThroughput), else the unit usage of the
+  /// itinerary stages, else assumes one instruction per issue slot.
+  double computeReciprocalThroughput(const MachineInstr *MI) const;
+
   /// \brief Output dependency latency of a pair of defs of the same register.
   ///
   /// This is typically one cycle.
@@ -15,6 +15,7 @@
 #ifndef LLVM_DEBUGINFO_DICONTEXT_H
 #define LLVM_DEBUGINFO_DICONTEXT_H
 
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/SmallVector.h"
@@ -138,16 +139,44 @@ public:
   virtual ~DIContext();
 
   /// getDWARFContext - get a context for binary DWARF data.
-  static DIContext *getDWARFContext(object::ObjectFile *);
+  ///
+  /// Compressed debug sections (.zdebug_* on ELF, __zdebug_* on Mach-O) are
+  /// accepted, and each is only decompressed the first time it is accessed.
+  ///
+  /// If \p NumThreads is greater than one, compile units are extracted and
+  /// their DIE trees parsed concurrently. Results, including dump output,
+  /// are always in compile unit order.
+  static DIContext *getDWARFContext(object::ObjectFile *,
+                                    unsigned NumThreads = 1);
 
   virtual void dump(raw_ostream &OS, DIDumpType DumpType = DIDT_All) = 0;
 
+  /// dumpForAddress - Dump the DIE tree of the compile unit covering
+  /// \p Address, and the line table rows for the address. Only that compile
+  /// unit is parsed. Returns false if no compile unit covers the address.
+  virtual bool dumpForAddress(raw_ostream &OS, uint64_t Address) = 0;
+
   virtual DILineInfo getLineInfoForAddress(uint64_t Address,
       DILineInfoSpecifier Specifier = DILineInfoSpecifier()) = 0;
   virtual DILineInfoTable getLineInfoForAddressRange(uint64_t Address,
       uint64_t Size, DILineInfoSpecifier Specifier = DILineInfoSpecifier()) = 0;
   virtual DIInliningInfo getInliningInfoForAddress(uint64_t Address,
       DILineInfoSpecifier Specifier = DILineInfoSpecifier()) = 0;
+
+  /// getInliningInfoForAddresses - Symbolize a batch of addresses, storing
+  /// the frames of Addresses[I] in Result[I]. The DWARF context sorts and
+  /// deduplicates the batch, resolves it on \p NumThreads threads, and
+  /// caches the inlining chain of each subprogram it visits, so a batch of
+  /// nearby addresses walks each DIE tree only once.
+  virtual void getInliningInfoForAddresses(ArrayRef<uint64_t> Addresses,
+                                           std::vector<DIInliningInfo> &Result,
+      DILineInfoSpecifier Specifier = DILineInfoSpecifier(),
+      unsigned NumThreads = 1) {
+    Result.clear();
+    Result.reserve(Addresses.size());
+    for (unsigned I = 0, E = Addresses.size(); I != E; ++I)
+      Result.push_back(getInliningInfoForAddress(Addresses[I], Specifier));
+  }
 private:
   const DIContextKind Kind;
 };
@@ -0,0 +1,107 @@
+//===-- DILineIndex.h -------------------------------------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file defines DILineIndex, a sorted address-to-line table built once
+// from a DIContext and queried with a binary search. It is intended for
+// clients that symbolize many addresses against the same binary.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_DEBUGINFO_DILINEINDEX_H
+#define LLVM_DEBUGINFO_DILINEINDEX_H
+
+#include "llvm/DebugInfo/DIContext.h"
+#include "llvm/Object/ObjectFile.h"
+#include <algorithm>
+#include <vector>
+
+namespace llvm {
+
+/// DILineIndex - line information for every address of a set of ranges,
+/// flattened across compile units and line table sequences.
+class DILineIndex {
+  typedef std::pair<uint64_t, DILineInfo> Row;
+
+  struct RowLess {
+    bool operator()(const Row &LHS, const Row &RHS) const {
+      return LHS.first < RHS.first;
+    }
+    bool operator()(uint64_t LHS, const Row &RHS) const {
+      return LHS < RHS.first;
+    }
+  };
+
+  /// Rows sorted by address. A row covers the addresses up to the next row.
+  std::vector<Row> Rows;
+
+  /// The [begin, end) address ranges that were indexed, sorted by begin.
+  std::vector<std::pair<uint64_t, uint64_t> > Ranges;
+
+  bool Sorted;
+
+public:
+  DILineIndex() : Sorted(true) {}
+
+  /// addRange - Add the line rows of [Address, Address + Size) to the index.
+  void addRange(DIContext &Ctx, uint64_t Address, uint64_t Size,
+                DILineInfoSpecifier Specifier = DILineInfoSpecifier()) {
+    if (Size == 0)
+      return;
+    DILineInfoTable Table =
+        Ctx.getLineInfoForAddressRange(Address, Size, Specifier);
+    Rows.insert(Rows.end(), Table.begin(), Table.end());
+    Ranges.push_back(std::make_pair(Address, Address + Size));
+    Sorted = false;
+  }
+
+  /// addTextSections - Add every text section of \p Obj to the index.
+  void addTextSections(DIContext &Ctx, const object::ObjectFile &Obj,
+                       DILineInfoSpecifier Specifier = DILineInfoSpecifier()) {
+    for (const object::SectionRef &Section : Obj.sections()) {
+      bool IsText;
+      uint64_t Address, Size;
+      if (Section.isText(IsText) || !IsText ||
+          Section.getAddress(Address) || Section.getSize(Size))
+        continue;
+      addRange(Ctx, Address, Size, Specifier);
+    }
+  }
+
+  /// finalize - Sort the index. Must be called after the last addRange and
+  /// before the first lookup.
+  void finalize() {
+    std::stable_sort(Rows.begin(), Rows.end(), RowLess());
+    std::sort(Ranges.begin(), Ranges.end());
+    Sorted = true;
+  }
+
+  /// lookup - Find the line row covering \p Address. Returns false if the
+  /// address is outside of every indexed range or precedes its first row.
+  bool lookup(uint64_t Address, DILineInfo &Result) const {
+    assert(Sorted && "DILineIndex used before finalize()");
+    std::vector<std::pair<uint64_t, uint64_t> >::const_iterator R =
+        std::upper_bound(Ranges.begin(), Ranges.end(),
+                         std::make_pair(Address, ~uint64_t(0)));
+    if (R == Ranges.begin() || Address >= (--R)->second)
+      return false;
+    std::vector<Row>::const_iterator I =
+        std::upper_bound(Rows.begin(), Rows.end(), Address, RowLess());
+    if (I == Rows.begin() || (I - 1)->first < R->first)
+      return false;
+    Result = (I - 1)->second;
+    return true;
+  }
+
+  size_t size() const { return Rows.size(); }
+  bool empty() const { return Rows.empty(); }
+};
+
+}
+
+#endif
@@ -0,0 +1,67 @@
+//===-- DwarfLinker.h -------------------------------------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file declares the DWARF linker behind a dsymutil replacement: it
+// gathers the debug information of the object files a Mach-O image was
+// linked from, relocates it to the final addresses and writes a single
+// dSYM companion file.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_DEBUGINFO_DWARFLINKER_H
+#define LLVM_DEBUGINFO_DWARFLINKER_H
+
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/DataTypes.h"
+#include "llvm/Support/system_error.h"
+
+namespace llvm {
+
+class raw_ostream;
+
+/// DwarfLinkerOptions - How linkDwarf builds the dSYM.
+struct DwarfLinkerOptions {
+  /// The number of threads the object files are parsed and relocated on.
+  /// A value of 0 uses one thread per hardware thread.
+  unsigned NumThreads;
+
+  /// If true, a C++ type that is defined in several compile units with the
+  /// same ODR signature (its qualified name, as a USR would spell it, and
+  /// the file and line of its declaration) is emitted once. Later compile
+  /// units refer to the first copy with DW_FORM_ref_addr instead of
+  /// carrying their own. Types in anonymous namespaces and C types are never
+  /// merged.
+  bool DeduplicateTypes;
+
+  /// If true, write what is done with each object file to Log.
+  bool Verbose;
+  raw_ostream *Log;
+
+  DwarfLinkerOptions()
+    : NumThreads(0), DeduplicateTypes(true), Verbose(false), Log(nullptr) {}
+};
+
+/// linkDwarf - Link the DWARF of the object files named by the debug map
+/// (the N_OSO stabs) of the Mach-O image \p ExecutablePath into
+/// \p OutputPath.
+///
+/// Each object file is mapped, parsed and has the DIEs of its live functions
+/// and variables selected and relocated on its own thread. The compile
+/// units are then numbered in debug map order, so the output does not
+/// depend on \p Opts.NumThreads. The sections are laid out with MCDwarf and
+/// written once, through a FileOutputBuffer of the final size.
+///
+/// \returns the first error found. An object file that cannot be read is
+/// skipped with a warning to Opts.Log, as dsymutil does.
+error_code linkDwarf(StringRef ExecutablePath, StringRef OutputPath,
+                     const DwarfLinkerOptions &Opts = DwarfLinkerOptions());
+
+}
+
+#endif
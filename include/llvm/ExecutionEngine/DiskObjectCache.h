@@ -0,0 +1,80 @@
+//===-- DiskObjectCache.h - Persistent ObjectCache on disk ------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file declares the DiskObjectCache class, an ObjectCache that keeps the
+// objects MCJIT generates in a directory so that later runs on the same
+// module can load them instead of compiling again.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_EXECUTIONENGINE_DISKOBJECTCACHE_H
+#define LLVM_EXECUTIONENGINE_DISKOBJECTCACHE_H
+
+#include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/ExecutionEngine/ObjectCache.h"
+#include "llvm/Support/DataTypes.h"
+#include <string>
+
+namespace llvm {
+
+class Module;
+
+/// DiskObjectCache - Stores each compiled object as a file named by a hash
+/// of everything that determines its contents: the module's bitcode, its
+/// target triple and the CPU and features it was compiled for.
+///
+/// Entries are written to a unique temporary file and renamed into place, so
+/// several processes may share a cache directory. A hit updates the
+/// modification time of its entry, and when the total size of the directory
+/// grows above the limit, the least recently used entries are removed until
+/// it fits again.
+class DiskObjectCache : public ObjectCache {
+  void anchor() override;
+
+  std::string CacheDir;
+  std::string CPU;
+  std::string Features;
+  uint64_t MaxSizeBytes;
+  unsigned NumHits, NumMisses;
+
+  /// computeKey - Compute the hexadecimal key of \p M.
+  void computeKey(const Module *M, SmallString<32> &Key) const;
+
+  /// getEntryPath - Compute the path of the entry for \p M.
+  void getEntryPath(const Module *M, SmallVectorImpl<char> &Path) const;
+
+public:
+  /// \p CPU and \p Features must be those the ExecutionEngine was built
+  /// with; they are part of every key. A \p MaxSizeBytes of 0 means the
+  /// cache is never pruned.
+  DiskObjectCache(StringRef CacheDir, StringRef CPU, StringRef Features,
+                  uint64_t MaxSizeBytes = 0)
+    : CacheDir(CacheDir), CPU(CPU), Features(Features),
+      MaxSizeBytes(MaxSizeBytes), NumHits(0), NumMisses(0) {}
+
+  /// notifyObjectCompiled - Write \p Obj as the entry of \p M, then prune
+  /// the cache if it is over its size limit.
+  void notifyObjectCompiled(const Module *M, const MemoryBuffer *Obj) override;
+
+  /// getObject - Return a copy of the entry of \p M, or null if there is
+  /// none.
+  MemoryBuffer *getObject(const Module *M) override;
+
+  /// prune - Remove least recently used entries until the cache holds at
+  /// most \p MaxBytes bytes.
+  void prune(uint64_t MaxBytes);
+
+  unsigned getNumHits() const { return NumHits; }
+  unsigned getNumMisses() const { return NumMisses; }
+};
+
+} // End llvm namespace
+
+#endif
@@ -477,6 +477,12 @@ public:
     llvm_unreachable("No support for ProcessAllSections option");
   }
 
+  /// setLazyCompileAhead - When compiling lazily, also compile the callees
+  /// of every function compiled on demand on a background thread, so that
+  /// most stubs have been redirected by the time they are first reached.
+  /// Only MCJIT implements this; other engines ignore it.
+  virtual void setLazyCompileAhead(bool Enabled) {}
+
   /// Return the target machine (if available).
   virtual TargetMachine *getTargetMachine() { return nullptr; }
 
@@ -493,6 +499,11 @@ public:
   /// stub, and 2) any thread modifying LLVM IR must hold the JIT's lock
   /// (ExecutionEngine::lock) or otherwise ensure that no other thread calls a
   /// lazy stub.  See http://llvm.org/PR5184 for details.
+  ///
+  /// MCJIT honors this too: with lazy compilation on, finalizeObject only
+  /// compiles the functions that are asked for and global initializers refer
+  /// to, each into its own object, and every other function with a body is
+  /// reached through a RuntimeDyld lazy compile stub.
   void DisableLazyCompilation(bool Disabled = true) {
     CompilingLazily = !Disabled;
   }
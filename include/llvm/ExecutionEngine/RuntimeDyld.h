@@ -62,6 +62,26 @@ public:
   /// and resolve relocatons based on where they put it).
   void *getSymbolAddress(StringRef Name);
 
+  /// Called by a lazy compile stub the first time it is reached. It must
+  /// compile and load the function \p Name and return its target address.
+  typedef uint64_t (*LazyCompileCallbackTy)(void *Ctx, StringRef Name);
+
+  /// Allocate a stub for the function \p Name, which has not been compiled
+  /// yet, and return its target address. Relocations against \p Name in
+  /// objects loaded later resolve to the stub. The first call through the
+  /// stub saves the argument registers, calls \p Callback, rewrites the stub
+  /// to jump to the address it returned and then jumps there itself, so
+  /// later calls only pay for one indirect jump.
+  ///
+  /// Returns 0 if the target has no stub implementation, in which case the
+  /// function must be compiled eagerly.
+  uint64_t createLazyCompileStub(StringRef Name, LazyCompileCallbackTy Callback,
+                                 void *Ctx);
+
+  /// Point the stub for \p Name at \p Addr without going through its
+  /// callback, e.g. once a background thread has compiled the function.
+  void updateLazyCompileStub(StringRef Name, uint64_t Addr);
+
   /// Get the address of the target copy of the symbol. This is the address
   /// used for relocation.
   uint64_t getSymbolLoadAddress(StringRef Name);
@@ -35,14 +35,37 @@ namespace llvm {
 /// in the JITed object.  Permissions can be applied either by calling
 /// MCJIT::finalizeObject or by calling SectionMemoryManager::finalizeMemory
 /// directly.  Clients of MCJIT should call MCJIT::finalizeObject.
+///
+/// Memory is mapped in slabs of at least SlabSize bytes, from which sections
+/// are carved, so loading many small objects does not cost a mapping each.
+/// finalizeMemory changes the protection of the sections allocated since the
+/// previous call only, merging adjacent ones into one call, and memory
+/// returned with freeMemory is made writable again and reused. This matters
+/// most on Windows, where VirtualAlloc and VirtualProtect are slow.
 class SectionMemoryManager : public RTDyldMemoryManager {
   SectionMemoryManager(const SectionMemoryManager&) LLVM_DELETED_FUNCTION;
   void operator=(const SectionMemoryManager&) LLVM_DELETED_FUNCTION;
 
 public:
-  SectionMemoryManager() { }
+  /// \p SlabSize is rounded up to the page size. The default of 0 maps 1MB
+  /// slabs, or a large page where the OS supports them.
+  explicit SectionMemoryManager(uintptr_t SlabSize = 0);
   virtual ~SectionMemoryManager();
 
+  /// Counters to tell how much mapping work the manager saved.
+  struct MemoryStats {
+    unsigned NumMappings;           ///< Calls to allocateMappedMemory.
+    unsigned NumProtectionChanges;  ///< Calls to protectMappedMemory.
+    uint64_t BytesMapped;
+    uint64_t BytesAllocated;        ///< Bytes handed out as sections.
+    uint64_t BytesReused;           ///< Bytes handed out from freed memory.
+    MemoryStats()
+      : NumMappings(0), NumProtectionChanges(0), BytesMapped(0),
+        BytesAllocated(0), BytesReused(0) {}
+  };
+
+  const MemoryStats &getStats() const { return Stats; }
+
   /// \brief Allocates a memory block of (at least) the given size suitable for
   /// executable code.
   ///
@@ -83,10 +106,21 @@ public:
   /// This method is called from finalizeMemory.
   virtual void invalidateInstructionCache();
 
+  /// \brief Return the section of \p Size bytes at \p Addr, which must have
+  /// come from this manager, for reuse by later allocations.
+  ///
+  /// Used when the code of a module is freed, e.g. after recompiling a
+  /// function into a new object. The memory is made read-write again at the
+  /// next finalizeMemory of its group.
+  void freeMemory(uint8_t *Addr, uintptr_t Size);
+
 private:
   struct MemoryGroup {
       SmallVector<sys::MemoryBlock, 16> AllocatedMem;
       SmallVector<sys::MemoryBlock, 16> FreeMem;
+      /// Sections allocated since the last finalizeMemory, in address
+      /// order. Only these need their protection changed.
+      SmallVector<sys::MemoryBlock, 16> PendingMem;
       sys::MemoryBlock Near;
   };
 
@@ -99,6 +133,8 @@ private:
   MemoryGroup CodeMem;
   MemoryGroup RWDataMem;
   MemoryGroup RODataMem;
+  uintptr_t SlabSize;
+  MemoryStats Stats;
 };
 
 }
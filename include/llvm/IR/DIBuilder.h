@@ -16,6 +16,7 @@
 #define LLVM_IR_DIBUILDER_H
 
 #include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/IR/DebugInfo.h"
 #include "llvm/IR/ValueHandle.h"
@@ -70,6 +71,10 @@ namespace llvm {
     /// Use TrackingVH to collect RetainTypes, since they can be updated
     /// later on.
     SmallVector<TrackingVH<MDNode>, 4> AllRetainTypes;
+    /// The types already in AllRetainTypes. Clang retains a type each time
+    /// it completes or references it, and a duplicate entry keeps nothing
+    /// alive that the first did not, so duplicates are not added.
+    SmallPtrSet<MDNode *, 16> RetainedTypeSet;
     SmallVector<Value *, 4> AllSubprograms;
     SmallVector<Value *, 4> AllGVs;
     SmallVector<TrackingVH<MDNode>, 4> AllImportedModules;
@@ -824,6 +824,15 @@ DIVariable cleanseInlinedVariable(MDNode *DV, LLVMContext &VMContext);
 /// Construct DITypeIdentifierMap by going through retained types of each CU.
 DITypeIdentifierMap generateDITypeIdentifierMap(const NamedMDNode *CU_Nodes);
 
+/// Remove from the retained types of every compile unit of \p M the
+/// composite types whose unique identifier is already retained, by this or
+/// another compile unit. References through the identifier resolve to the
+/// first definition, so the others are only kept alive by these lists. The
+/// linker runs this after linking in a module, which lets uniquing drop the
+/// duplicated type graphs of headers included in many translation units.
+/// Return true if module is modified.
+bool uniqueRetainedTypes(Module &M);
+
 /// Strip debug info in the module if it exists.
 /// To do this, we remove all calls to the debugger intrinsics and any named
 /// metadata for debugging. We also remove debug locations for instructions.
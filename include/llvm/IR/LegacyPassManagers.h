@@ -224,6 +224,16 @@ public:
   void dumpPasses() const;
   void dumpArguments() const;
 
+  /// Record that analysis \p AID was run because no valid result of it was
+  /// available. PMDataManager calls this each time it schedules an analysis
+  /// that an earlier pass invalidated, so the count minus one is the number
+  /// of recomputations.
+  void noteAnalysisRun(AnalysisID AID) { ++AnalysisRunCounts[AID]; }
+
+  /// Print, for each analysis run more than once, how many times it ran.
+  /// Printed with the -time-passes report, next to the time those runs took.
+  void dumpAnalysisRunCounts(raw_ostream &OS) const;
+
   // Active Pass Managers
   PMStack activeStack;
 
@@ -251,6 +261,9 @@ private:
   SmallVector<ImmutablePass *, 8> ImmutablePasses;
 
   DenseMap<Pass *, AnalysisUsage *> AnUsageMap;
+
+  /// Number of times each analysis was run, see noteAnalysisRun.
+  DenseMap<AnalysisID, unsigned> AnalysisRunCounts;
 };
 
 
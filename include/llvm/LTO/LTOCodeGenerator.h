@@ -41,15 +41,19 @@
 #include "llvm/ADT/StringMap.h"
 #include "llvm/Linker/Linker.h"
 #include "llvm/Target/TargetOptions.h"
+#include <memory>
 #include <string>
 #include <vector>
 
+class LTOObjectCache;
+
 namespace llvm {
   class LLVMContext;
   class DiagnosticInfo;
   class GlobalValue;
   class Mangler;
   class MemoryBuffer;
+  class Module;
   class TargetLibraryInfo;
   class TargetMachine;
   class raw_ostream;
@@ -74,6 +78,11 @@ struct LTOCodeGenerator {
 
   void setCpu(const char *mCpu) { MCpu = mCpu; }
 
+  // Cache the object generated for each partition in the given directory,
+  // and reuse it on later links if the partition's optimized IR, the target
+  // options and the CPU are unchanged. An empty path disables the cache.
+  void setObjectCacheDir(const char *path) { ObjectCacheDir = path; }
+
   void addMustPreserveSymbol(const char *sym) { MustPreserveSymbols[sym] = 1; }
 
   // To pass options to the driver and optimization passes. These options are
@@ -115,6 +124,38 @@ struct LTOCodeGenerator {
                       bool disableGVNLoadPRE,
                       std::string &errMsg);
 
+  // Split the merged module into this many partitions after IPO and run
+  // code generation on them in parallel. 1 (the default) disables
+  // partitioning.
+  void setCodeGenPartitions(unsigned N) { CodeGenPartitions = N ? N : 1; }
+  unsigned getCodeGenPartitions() const { return CodeGenPartitions; }
+
+  // Also run the function-local part of the LTO pipeline on the partitions,
+  // in parallel, instead of on the merged module before splitting it. Only
+  // the inter-procedural passes then run serially. Each partition lives in
+  // its own LLVMContext, so no IR state is shared between the threads. Has
+  // no effect unless there is more than one partition.
+  void setParallelFunctionPasses(bool Enable) {
+    ParallelFunctionPasses = Enable;
+  }
+
+  // Run GlobalMerge, constants included, on the internalized module before
+  // code generation, so globals used together share one base address. This
+  // is on by default for ARM targets, which otherwise materialize every
+  // global's address with its own movw/movt pair or literal pool load.
+  void setMergeGlobals(bool Enable) { MergeGlobals = Enable; }
+
+  // Run IPO on the merged module, split it into getCodeGenPartitions()
+  // partitions and compile each partition into its own object buffer. The
+  // buffers remain owned by the code generator and are returned in partition
+  // order, which only depends on the module and the partition count. Return
+  // true on success.
+  bool compile_partitions(std::vector<const llvm::MemoryBuffer *> &objects,
+                          bool disableOpt,
+                          bool disableInline,
+                          bool disableGVNLoadPRE,
+                          std::string &errMsg);
+
   void setDiagnosticHandler(lto_diagnostic_handler_t, void *);
 
 private:
@@ -125,6 +166,11 @@ private:
                           bool disableInline,
                           bool disableGVNLoadPRE,
                           std::string &errMsg);
+  // Split the optimized merged module into getCodeGenPartitions() modules,
+  // assigning each function to a partition by a stable hash of its name and
+  // giving every partition external declarations of the globals it uses.
+  bool splitMergedModule(std::vector<llvm::Module *> &partitions,
+                         std::string &errMsg);
   void applyScopeRestrictions();
   void applyRestriction(llvm::GlobalValue &GV,
                         const llvm::ArrayRef<llvm::StringRef> &Libcalls,
@@ -148,9 +194,15 @@ private:
   StringSet MustPreserveSymbols;
   StringSet AsmUndefinedRefs;
   llvm::MemoryBuffer *NativeObjectFile;
+  std::vector<llvm::MemoryBuffer *> NativePartitionFiles;
+  unsigned CodeGenPartitions;
+  bool ParallelFunctionPasses;
+  bool MergeGlobals;
   std::vector<char *> CodegenOptions;
   std::string MCpu;
   std::string NativeObjectPath;
+  std::string ObjectCacheDir;
+  std::unique_ptr<LTOObjectCache> ObjectCache;
   llvm::TargetOptions Options;
   lto_diagnostic_handler_t DiagHandler;
   void *DiagContext;
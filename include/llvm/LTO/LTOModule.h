@@ -64,6 +64,9 @@ private:
   // Use mangler to add GlobalPrefix to names to match linker names.
   llvm::Mangler                           _mangler;
 
+  // Whether function bodies are still held by the module's GVMaterializer.
+  bool                                    _lazy;
+
   LTOModule(llvm::Module *m, llvm::TargetMachine *t);
 public:
   /// isBitcodeFile - Returns 'true' if the file or memory contents is LLVM
@@ -102,6 +105,17 @@ public:
                                   std::string &errMsg,
                                   llvm::StringRef path = "");
 
+  /// isLazy - Returns 'true' if the module was read without its function
+  /// bodies. Symbol information is complete either way, since it only
+  /// depends on the global value records.
+  bool isLazy() const { return _lazy; }
+
+  /// materializeAll - Read every function body that was skipped when the
+  /// module was created. This is done when the linker adds the module to a
+  /// code generator, so archive members which are never selected are never
+  /// fully parsed. Returns 'true' on success.
+  bool materializeAll(std::string &errMsg);
+
   /// getTargetTriple - Return the Module's target triple.
   const char *getTargetTriple() {
     return _module->getTargetTriple().c_str();
@@ -218,6 +232,9 @@ private:
 
   /// makeLTOModule - Create an LTOModule (private version). N.B. This
   /// method takes ownership of the buffer.
+  ///
+  /// The module is read with getLazyBitcodeModule, so only the module-level
+  /// records are parsed and function bodies are left to the materializer.
   static LTOModule *makeLTOModule(llvm::MemoryBuffer *buffer,
                                   llvm::TargetOptions options,
                                   std::string &errMsg);
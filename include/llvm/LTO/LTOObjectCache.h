@@ -0,0 +1,73 @@
+//===-LTOObjectCache.h - On-disk cache of LTO partition objects -----------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file declares the LTOObjectCache class, a persistent ObjectCache
+// used by LTOCodeGenerator to skip code generation for partitions whose
+// optimized IR did not change since the previous link.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LTO_OBJECT_CACHE_H
+#define LTO_OBJECT_CACHE_H
+
+#include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/ExecutionEngine/ObjectCache.h"
+#include <string>
+
+namespace llvm {
+  class Module;
+  class TargetMachine;
+}
+
+//===----------------------------------------------------------------------===//
+/// LTOObjectCache - Stores the native object generated for a module in a
+/// cache directory. The key of an entry is the MD5 of the module's bitcode,
+/// combined with the target triple, CPU, features, TargetOptions and
+/// optimization level of the TargetMachine used to compile it, so a change
+/// to any of them produces a different object.
+///
+class LTOObjectCache : public llvm::ObjectCache {
+  void anchor() override;
+
+public:
+  LTOObjectCache(llvm::StringRef CacheDir, const llvm::TargetMachine &TM)
+    : CacheDir(CacheDir), TM(TM), NumHits(0), NumMisses(0) {}
+
+  // Write Obj to the cache entry of M. The entry is written to a temporary
+  // file first and renamed into place, so concurrent links sharing the
+  // cache directory never see a partial object.
+  void notifyObjectCompiled(const llvm::Module *M,
+                            const llvm::MemoryBuffer *Obj) override;
+
+  // Return a copy of the cached object for M, or null if there is none.
+  llvm::MemoryBuffer *getObject(const llvm::Module *M) override;
+
+  // Remove cache entries which have not been used in the given number of
+  // seconds.
+  void prune(unsigned MaxAgeSeconds);
+
+  unsigned getNumHits() const { return NumHits; }
+  unsigned getNumMisses() const { return NumMisses; }
+
+private:
+  // Compute the hexadecimal cache key of M.
+  void computeKey(const llvm::Module *M, llvm::SmallString<32> &Key) const;
+
+  // Compute the path of the cache entry for M.
+  void getEntryPath(const llvm::Module *M,
+                    llvm::SmallVectorImpl<char> &Path) const;
+
+  std::string CacheDir;
+  const llvm::TargetMachine &TM;
+  unsigned NumHits;
+  unsigned NumMisses;
+};
+
+#endif // LTO_OBJECT_CACHE_H
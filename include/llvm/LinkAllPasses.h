@@ -75,11 +75,13 @@ namespace {
       (void) llvm::createDomOnlyViewerPass();
       (void) llvm::createDomViewerPass();
       (void) llvm::createGCOVProfilerPass();
+      (void) llvm::createFunctionOrderTracingPass();
       (void) llvm::createFunctionInliningPass();
       (void) llvm::createAlwaysInlinerPass();
       (void) llvm::createGlobalDCEPass();
       (void) llvm::createGlobalOptimizerPass();
       (void) llvm::createGlobalsModRefPass();
+      (void) llvm::createHotColdSplittingPass();
       (void) llvm::createIPConstantPropagationPass();
       (void) llvm::createIPSCCPPass();
       (void) llvm::createIndVarSimplifyPass();
@@ -102,11 +104,17 @@ namespace {
       (void) llvm::createNoAAPass();
       (void) llvm::createObjCARCAliasAnalysisPass();
       (void) llvm::createObjCARCAPElimPass();
+      (void) llvm::createObjCARCBlockStackPromotionPass();
       (void) llvm::createObjCARCExpandPass();
       (void) llvm::createObjCARCContractPass();
+      (void) llvm::createObjCARCIPOPass();
       (void) llvm::createObjCARCOptPass();
+      (void) llvm::createObjCIvarOffsetFoldingPass();
+      (void) llvm::createObjCMetadataStripPass();
+      (void) llvm::createObjCMsgSendDevirtPass();
       (void) llvm::createPromoteMemoryToRegisterPass();
       (void) llvm::createDemoteRegisterToMemoryPass();
+      (void) llvm::createProfileCounterPromotionPass();
       (void) llvm::createPruneEHPass();
       (void) llvm::createPostDomOnlyPrinterPass();
       (void) llvm::createPostDomPrinterPass();
@@ -143,6 +151,7 @@ namespace {
       (void) llvm::createPrintModulePass(*(llvm::raw_ostream*)0);
       (void) llvm::createPrintFunctionPass(*(llvm::raw_ostream*)0);
       (void) llvm::createPrintBasicBlockPass(*(llvm::raw_ostream*)0);
+      (void) llvm::createStartupReportPass(*(llvm::raw_ostream*)0);
       (void) llvm::createModuleDebugInfoPrinterPass();
       (void) llvm::createPartialInliningPass();
       (void) llvm::createLintPass();
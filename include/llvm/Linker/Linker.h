@@ -27,7 +27,8 @@ class Linker {
   public:
     enum LinkerMode {
       DestroySource = 0, // Allow source module to be destroyed.
-      PreserveSource = 1 // Preserve the source module.
+      PreserveSource = 1, // Preserve the source module.
+      LinkOnlyNeeded = 2  // Only link in globals the composite references.
     };
 
     Linker(Module *M, bool SuppressWarnings=false);
@@ -38,6 +39,16 @@ class Linker {
 
     /// \brief Link \p Src into the composite. The source is destroyed if
     /// \p Mode is DestroySource and preserved if it is PreserveSource.
+    ///
+    /// If \p Mode also has the LinkOnlyNeeded bit, a definition in \p Src is
+    /// only linked in if the composite has an unresolved reference to it, or
+    /// if something linked in this way references it. Function bodies of a
+    /// lazily loaded \p Src (see getLazyBitcodeModule and
+    /// getStreamedBitcodeModule) are only materialized for the definitions
+    /// that are linked, so the rest of the file is never read into memory.
+    ///
+    /// Debug info types that the composite already has a definition of, by
+    /// unique identifier, are not linked in again (see uniqueRetainedTypes).
     /// If \p ErrorMsg is not null, information about any error is written
     /// to it.
     /// Returns true on error.
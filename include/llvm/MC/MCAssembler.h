@@ -93,6 +93,17 @@ public:
   MCFragment();
   virtual ~MCFragment();
 
+  /// Fragments are allocated from the BumpPtrAllocator of an MCContext, as in
+  /// 'new (Ctx) MCDataFragment(SD)', and are never freed individually; their
+  /// memory is reclaimed when the context is reset.
+  void *operator new(size_t Bytes, MCContext &Ctx, unsigned Alignment = 8);
+  void operator delete(void *, MCContext &, unsigned) {}
+  void operator delete(void *) {}
+
+private:
+  void *operator new(size_t Bytes) LLVM_DELETED_FUNCTION;
+
+public:
   FragmentType getKind() const { return Kind; }
 
   MCSectionData *getParent() const { return Parent; }
@@ -129,6 +140,27 @@ public:
   void dump();
 };
 
+/// Fragments are owned by the allocator of their MCContext, so removing one
+/// from its section only runs its destructor. The list sentinel is embedded
+/// in the traits rather than allocated.
+template <>
+struct ilist_traits<MCFragment> : public ilist_default_traits<MCFragment> {
+  mutable ilist_half_node<MCFragment> Sentinel;
+public:
+  MCFragment *createSentinel() const {
+    return static_cast<MCFragment*>(&Sentinel);
+  }
+  void destroySentinel(MCFragment *) const {}
+
+  MCFragment *provideInitialHead() const { return createSentinel(); }
+  MCFragment *ensureHead(MCFragment*) const { return createSentinel(); }
+  static void noteHead(MCFragment*, MCFragment*) {}
+
+  static void deleteNode(MCFragment *F) { F->~MCFragment(); }
+private:
+  void createNode(const MCFragment &);
+};
+
 /// Interface implemented by fragments that contain encoded instructions and/or
 /// data.
 ///
@@ -922,6 +954,20 @@ private:
   MCLOHContainer LOHContainer;
 
   VersionMinInfoType VersionMinInfo;
+
+  /// The number of threads used to lay out independent sections.
+  unsigned LayoutThreads;
+
+  /// Sections whose fixups only refer to symbols in the same section, and
+  /// which can therefore be relaxed independently of every other section.
+  SmallPtrSet<const MCSectionData*, 16> IndependentSections;
+
+  /// For each section, the relaxable fragments which the next layout
+  /// iteration has to revisit: those whose own offset moved in the previous
+  /// iteration, or which have a fixup referring to a fragment that moved. A
+  /// section without an entry has all of its fragments revisited.
+  DenseMap<const MCSectionData*,
+           SmallPtrSet<const MCFragment*, 16> > PendingRelaxation;
 private:
   /// Evaluate a fixup to a relocatable expression and the value which should be
   /// placed into the fixup.
@@ -955,8 +1001,20 @@ private:
 
   /// \brief Perform one layout iteration of the given section and return true
   /// if any offsets were adjusted.
+  ///
+  /// Only the fragments recorded in PendingRelaxation for the section are
+  /// checked for relaxation, and the set is replaced with the fragments
+  /// affected by this iteration.
   bool layoutSectionOnce(MCAsmLayout &Layout, MCSectionData &SD);
 
+  /// \brief Lay out and relax the independent sections concurrently until
+  /// none changes, then return true if any offsets were adjusted.
+  bool layoutIndependentSections(MCAsmLayout &Layout);
+
+  /// \brief Populate IndependentSections by checking the targets of every
+  /// fixup in each section.
+  void computeIndependentSections(const MCAsmLayout &Layout);
+
   bool relaxInstruction(MCAsmLayout &Layout, MCRelaxableFragment &IF);
 
   bool relaxLEB(MCAsmLayout &Layout, MCLEBFragment &IF);
@@ -1055,6 +1113,12 @@ public:
   bool getRelaxAll() const { return RelaxAll; }
   void setRelaxAll(bool Value) { RelaxAll = Value; }
 
+  /// Set the number of threads used to relax sections that have no fixups
+  /// referring to other sections. A value of 1 lays out every section on
+  /// the calling thread.
+  unsigned getLayoutThreads() const { return LayoutThreads; }
+  void setLayoutThreads(unsigned Value) { LayoutThreads = Value ? Value : 1; }
+
   bool getNoExecStack() const { return NoExecStack; }
   void setNoExecStack(bool Value) { NoExecStack = Value; }
 
@@ -20,6 +20,7 @@
 
 namespace llvm {
 
+class FileOutputBuffer;
 class MCSectionData;
 class MachObjectWriter;
 
@@ -235,6 +236,12 @@ public:
 
   void BindIndirectSymbols(MCAssembler &Asm);
 
+  /// CompressDebugSections - Replace the contents of every __debug_* section
+  /// of the __DWARF segment with its zlib compressed form, renaming it to
+  /// __zdebug_*. Sections with fixups, or which would not shrink, are left
+  /// alone. Only done if the MCAsmInfo requests compressed debug sections.
+  void CompressDebugSections(MCAssembler &Asm, MCAsmLayout &Layout);
+
   /// ComputeSymbolTable - Compute the symbol table data
   ///
   /// \param StringTable [out] - The string table data.
@@ -258,6 +265,19 @@ public:
                                               bool IsPCRel) const override;
 
   void WriteObject(MCAssembler &Asm, const MCAsmLayout &Layout) override;
+
+  /// computeObjectFileSize - Compute the exact size of the object that
+  /// WriteObject would produce for this layout, including load commands,
+  /// section data, relocation tables, the symbol table and the string table.
+  uint64_t computeObjectFileSize(MCAssembler &Asm, const MCAsmLayout &Layout);
+
+  /// WriteObjectToBuffer - Emit the object in place into \p Buffer, which
+  /// must be at least computeObjectFileSize() bytes long. Every section and
+  /// relocation table is written directly at its final file offset, so no
+  /// intermediate stream is involved and independent sections can be
+  /// written concurrently.
+  void WriteObjectToBuffer(MCAssembler &Asm, const MCAsmLayout &Layout,
+                           FileOutputBuffer &Buffer);
 };
 
 
@@ -64,6 +64,11 @@ protected:
   ///
   const MCSection *TextSection;
 
+  /// TextColdSection - Section directive for code that is not expected to
+  /// run: __TEXT,__text_cold on Darwin, .text.unlikely on ELF. Null if the
+  /// object format has no such convention.
+  const MCSection *TextColdSection;
+
   /// DataSection - Section directive for standard data.
   ///
   const MCSection *DataSection;
@@ -227,6 +232,7 @@ public:
   }
 
   const MCSection *getTextSection() const { return TextSection; }
+  const MCSection *getTextColdSection() const { return TextColdSection; }
   const MCSection *getDataSection() const { return DataSection; }
   const MCSection *getBSSSection() const { return BSSSection; }
   const MCSection *getLSDASection() const { return LSDASection; }
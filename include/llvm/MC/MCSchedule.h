@@ -21,6 +21,7 @@
 namespace llvm {
 
 struct InstrItinerary;
+class MCSubtargetInfo;
 
 /// Define a kind of processor resource that will be modeled by the scheduler.
 struct MCProcResourceDesc {
@@ -244,6 +245,15 @@ public:
     assert(SchedClassIdx < NumSchedClasses && "bad scheduling class idx");
     return &SchedClassTable[SchedClassIdx];
   }
+
+  /// Returns the reciprocal throughput of the scheduling class \p SCDesc: the
+  /// average number of cycles between successive issues of independent
+  /// instructions of that class, as bounded by the most contended processor
+  /// resource it uses. Units of a resource are assumed to be used evenly, so
+  /// a resource with 2 units held for 4 cycles gives 2.0. Instructions that
+  /// use no resources are bounded by the issue width instead.
+  static double getReciprocalThroughput(const MCSubtargetInfo &STI,
+                                        const MCSchedClassDesc &SCDesc);
 };
 
 } // End llvm namespace
@@ -0,0 +1,109 @@
+//===-- llvm/MC/MCThroughputAnalysis.h - Static block cost ------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file declares the MCThroughputAnalysis class, which estimates the
+// steady state cost of a straight line sequence of MCInsts, such as the body
+// of a hot loop, on a given CPU without running it.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_MC_MCTHROUGHPUTANALYSIS_H
+#define LLVM_MC_MCTHROUGHPUTANALYSIS_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/MC/MCInst.h"
+#include "llvm/MC/MCInstrItineraries.h"
+#include <vector>
+
+namespace llvm {
+
+class MCInstPrinter;
+class MCInstrInfo;
+class MCRegisterInfo;
+class MCSubtargetInfo;
+class raw_ostream;
+
+/// MCThroughputAnalysis - Simulate dispatch and issue of an instruction
+/// sequence, repeated a number of times, on the processor described by an
+/// MCSubtargetInfo.
+///
+/// Each instruction is dispatched in order, at most IssueWidth per cycle. It
+/// issues once its register operands are ready and, for an in-order core
+/// (MicroOpBufferSize of 0), once every older instruction has issued. Issue
+/// then reserves the processor resources of its scheduling class for their
+/// listed cycles, or the functional units of its itinerary stages when the
+/// CPU has only an itinerary. Register dependencies are tracked through the
+/// MCInst operands with the def and use latencies of the model, including
+/// dependencies carried from one iteration to the next.
+///
+/// Memory dependencies, branch prediction and cache behaviour are not
+/// modeled; the result is a lower bound on the cycles per iteration.
+class MCThroughputAnalysis {
+public:
+  /// InstrStats - What the simulation observed for one instruction of the
+  /// sequence, averaged over the iterations.
+  struct InstrStats {
+    /// Cycles spent by each processor resource kind on this instruction,
+    /// indexed like the machine model's resource table.
+    std::vector<double> ResourcePressure;
+    /// Average cycles between dispatch and issue.
+    double AvgWaitCycles;
+    /// Latency from issue until the last def is available.
+    unsigned Latency;
+    InstrStats() : AvgWaitCycles(0), Latency(0) {}
+  };
+
+private:
+  const MCSubtargetInfo &STI;
+  const MCInstrInfo &MCII;
+  const MCRegisterInfo &MRI;
+  InstrItineraryData Itins;
+
+  std::vector<MCInst> Insts;
+  std::vector<InstrStats> Stats;
+  unsigned Iterations;
+  unsigned TotalCycles;
+  unsigned NumDispatchStalls;
+
+public:
+  MCThroughputAnalysis(const MCSubtargetInfo &STI, const MCInstrInfo &MCII,
+                       const MCRegisterInfo &MRI);
+
+  /// addInstruction - Append \p Inst to the sequence being analyzed.
+  void addInstruction(const MCInst &Inst) { Insts.push_back(Inst); }
+
+  ArrayRef<MCInst> getInstructions() const { return Insts; }
+
+  /// run - Simulate \p NumIterations back to back executions of the
+  /// sequence. A hundred iterations are enough to reach the steady state of
+  /// any loop body that fits in the core's buffers.
+  void run(unsigned NumIterations = 100);
+
+  /// getBlockRThroughput - The cycles per iteration bounded by resource use
+  /// alone, ignoring dependencies: what the sequence would cost if it were
+  /// perfectly scheduled.
+  double getBlockRThroughput() const;
+
+  /// getCyclesPerIteration - The cycles per iteration observed by run().
+  double getCyclesPerIteration() const {
+    return Iterations ? double(TotalCycles) / Iterations : 0;
+  }
+
+  /// getStats - The statistics of instruction \p Idx of the sequence.
+  const InstrStats &getStats(unsigned Idx) const { return Stats[Idx]; }
+
+  /// printReport - Print the cycles per iteration, IPC, block reciprocal
+  /// throughput and per-resource usage, followed by one line per
+  /// instruction giving its latency, wait cycles and resource pressure.
+  void printReport(raw_ostream &OS, MCInstPrinter &Printer) const;
+};
+
+} // End llvm namespace
+
+#endif
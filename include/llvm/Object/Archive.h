@@ -14,8 +14,10 @@
 #ifndef LLVM_OBJECT_ARCHIVE_H
 #define LLVM_OBJECT_ARCHIVE_H
 
+#include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Object/Binary.h"
+#include "llvm/Support/Allocator.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/ErrorOr.h"
 #include "llvm/Support/FileSystem.h"
@@ -83,12 +85,22 @@ public:
       return getHeader()->getAccessMode();
     }
     /// \return the size of the archive member without the header or padding.
-    uint64_t getSize() const { return Data.size() - StartOfFile; }
+    uint64_t getSize() const {
+      if (Parent->IsThin)
+        return getHeader()->getSize();
+      return Data.size() - StartOfFile;
+    }
 
+    /// \return the contents of the member as stored in the archive. This is
+    /// empty for members of a thin archive; use getMemoryBuffer() instead.
     StringRef getBuffer() const {
+      if (Parent->IsThin)
+        return StringRef();
       return StringRef(Data.data() + StartOfFile, getSize());
     }
 
+    /// \brief Get the contents of the member. For a member of a thin archive
+    /// this maps the file the member refers to, on first use.
     error_code getMemoryBuffer(OwningPtr<MemoryBuffer> &Result,
                                bool FullPath = false) const;
     error_code getMemoryBuffer(std::unique_ptr<MemoryBuffer> &Result,
@@ -181,6 +193,11 @@ public:
     return Format;
   }
 
+  /// \brief Whether this is a thin archive ("!<thin>\n"), whose members are
+  /// paths of files relative to the archive rather than copies of them.
+  /// Only the headers, symbol table and string table are in the archive.
+  bool isThin() const { return IsThin; }
+
   child_iterator child_begin(bool SkipInternal = true) const;
   child_iterator child_end() const;
 
@@ -193,15 +210,35 @@ public:
   }
 
   // check if a symbol is in the archive
+  //
+  // If the symbol table is sorted by name, this is a binary search over it.
+  // Otherwise the first call builds a hash index of the whole symbol table,
+  // which is used for this and every later lookup.
   child_iterator findSym(StringRef name) const;
 
   bool hasSymbolTable() const;
 
+  // Whether the symbol table is sorted by symbol name, as written by
+  // 'llvm-ranlib -S' into a "__.SYMDEF SORTED" member.
+  bool isSymbolTableSorted() const { return SymbolTableSorted; }
+
 private:
+  // Build SymbolIndex from the symbol table.
+  void buildSymbolIndex() const;
+
+  // Binary search a sorted symbol table.
+  child_iterator findSymSorted(StringRef name) const;
+
   child_iterator SymbolTable;
   child_iterator StringTable;
   child_iterator FirstRegular;
   Kind Format;
+  bool SymbolTableSorted;
+  bool IsThin;
+
+  // Maps symbol names to the offset in the archive of the member defining
+  // them. Built on the first findSym call on an unsorted symbol table.
+  mutable std::unique_ptr<StringMap<uint32_t, BumpPtrAllocator> > SymbolIndex;
 };
 
 }
@@ -0,0 +1,72 @@
+//===- ArchiveWriter.h - ar archive file format writer ----------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file declares the interface llvm-ar and llvm-ranlib use to write
+// archives.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_OBJECT_ARCHIVEWRITER_H
+#define LLVM_OBJECT_ARCHIVEWRITER_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Object/Archive.h"
+#include "llvm/Support/system_error.h"
+
+namespace llvm {
+
+class LLVMContext;
+
+namespace object {
+
+/// NewArchiveMember - A member of the archive being written: either a member
+/// of an existing archive kept as it is, or a file on disk.
+struct NewArchiveMember {
+  /// If non-null, the member is copied from here and the fields below are
+  /// unused except for Name.
+  const Archive::Child *OldMember;
+  /// The path of the file to add.
+  StringRef FileName;
+  /// The name it is stored under.
+  StringRef Name;
+
+  NewArchiveMember(const Archive::Child &Old, StringRef Name)
+    : OldMember(&Old), Name(Name) {}
+  NewArchiveMember(StringRef FileName, StringRef Name)
+    : OldMember(nullptr), FileName(FileName), Name(Name) {}
+};
+
+/// writeArchive - Write \p Members to \p ArcName in the order given.
+///
+/// The archive is laid out in a FileOutputBuffer of its final size and
+/// committed with a single rename, so readers never see a partial file.
+/// When \p WriteSymtab is true, members are parsed as SymbolicFiles on
+/// \p NumThreads threads to collect their global symbols. A member that is
+/// byte for byte the same as a member of \p OldArchive, compared by size
+/// and then by content hash, takes its symbols from the symbol table of
+/// \p OldArchive without being parsed again. If \p OldArchive is \p ArcName
+/// and nothing changed, the file is left alone.
+///
+/// If \p Thin is true, a thin archive is written: member headers refer to
+/// the files by path and no member data is copied. Members taken from an
+/// existing archive must then be members of a thin archive too.
+///
+/// \returns the name of the file that caused the failure, if any, and the
+/// error.
+std::pair<StringRef, error_code>
+writeArchive(StringRef ArcName, ArrayRef<NewArchiveMember> Members,
+             bool WriteSymtab, bool Thin = false,
+             const Archive *OldArchive = nullptr,
+             LLVMContext *Context = nullptr, unsigned NumThreads = 1);
+
+}
+}
+
+#endif
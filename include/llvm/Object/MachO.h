@@ -18,6 +18,7 @@
 #include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/Triple.h"
+#include "llvm/ADT/iterator_range.h"
 #include "llvm/Object/ObjectFile.h"
 #include "llvm/Support/MachO.h"
 
@@ -105,8 +106,54 @@ public:
                             LibraryRef &Res) const override;
   error_code getLibraryPath(DataRefImpl LibData, StringRef &Res) const override;
 
-  // TODO: Would be useful to have an iterator based version
-  // of the load command interface too.
+  /// load_command_iterator - Walks the load commands in file order straight
+  /// out of the mapped buffer. Each step decodes only the header of the next
+  /// command, so a dump can print as it goes in constant memory.
+  class load_command_iterator {
+    const MachOObjectFile *Obj;
+    unsigned Index;
+    LoadCommandInfo Info;
+
+  public:
+    load_command_iterator(const MachOObjectFile *Obj, unsigned Index)
+      : Obj(Obj), Index(Index) {
+      Info.Ptr = nullptr;
+      if (Index < Obj->getNumLoadCommands())
+        Info = Obj->getFirstLoadCommandInfo();
+    }
+
+    const LoadCommandInfo &operator*() const { return Info; }
+    const LoadCommandInfo *operator->() const { return &Info; }
+
+    load_command_iterator &operator++() {
+      if (++Index < Obj->getNumLoadCommands())
+        Info = Obj->getNextLoadCommandInfo(Info);
+      else
+        Info.Ptr = nullptr;
+      return *this;
+    }
+
+    bool operator==(const load_command_iterator &Other) const {
+      return Obj == Other.Obj && Index == Other.Index;
+    }
+    bool operator!=(const load_command_iterator &Other) const {
+      return !(*this == Other);
+    }
+  };
+
+  unsigned getNumLoadCommands() const {
+    return is64Bit() ? getHeader64().ncmds : getHeader().ncmds;
+  }
+  load_command_iterator begin_load_commands() const {
+    return load_command_iterator(this, 0);
+  }
+  load_command_iterator end_load_commands() const {
+    return load_command_iterator(this, getNumLoadCommands());
+  }
+  iterator_range<load_command_iterator> load_commands() const {
+    return iterator_range<load_command_iterator>(begin_load_commands(),
+                                                 end_load_commands());
+  }
 
   basic_symbol_iterator symbol_begin_impl() const override;
   basic_symbol_iterator symbol_end_impl() const override;
@@ -190,8 +237,26 @@ public:
   MachO::symtab_command getSymtabLoadCommand() const;
   MachO::dysymtab_command getDysymtabLoadCommand() const;
   MachO::linkedit_data_command getDataInCodeLoadCommand() const;
+  MachO::linkedit_data_command getFunctionStartsLoadCommand() const;
+
+  /// getFunctionStarts - Decode the LC_FUNCTION_STARTS table into the
+  /// ascending addresses of the functions it lists, the first relative to the
+  /// start of the __TEXT segment. Leaves \p Out empty if there is no table.
+  /// Together with the symbol table, this splits __text into function ranges
+  /// that can be disassembled independently of each other.
+  void getFunctionStarts(SmallVectorImpl<uint64_t> &Out) const;
 
   StringRef getStringTableData() const;
+
+  /// getNumberOfSymbols - The number of entries in the symbol table.
+  uint32_t getNumberOfSymbols() const;
+
+  /// getSymbolByIndex - The symbol at \p Index of the symbol table. Together
+  /// with getNumberOfSymbols this gives random access to the symbols, so that
+  /// tools can sort and filter an array of indices instead of copying every
+  /// name. The names returned by getSymbolName point into the mapped string
+  /// table and stay valid as long as the object.
+  DataRefImpl getSymbolByIndex(uint32_t Index) const;
   bool is64Bit() const;
   void ReadULEB128s(uint64_t Index, SmallVectorImpl<uint64_t> &Out) const;
 
@@ -207,6 +272,7 @@ private:
   const char *SymtabLoadCmd;
   const char *DysymtabLoadCmd;
   const char *DataInCodeLoadCmd;
+  const char *FunctionStartsLoadCmd;
 };
 
 /// DiceRef
@@ -0,0 +1,62 @@
+//===- MachOCodeSignature.h - Ad hoc Mach-O code signing --------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file declares support for computing the code directory of an ad hoc
+// ("fake") Mach-O code signature, the job ldid does after every link.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_OBJECT_MACHOCODESIGNATURE_H
+#define LLVM_OBJECT_MACHOCODESIGNATURE_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/SHA1.h"
+#include "llvm/Support/system_error.h"
+#include <cstring>
+#include <vector>
+
+namespace llvm {
+namespace object {
+
+/// PageHash - The SHA-1 of one page of the signed range.
+struct PageHash {
+  SHA1::SHA1Result Bytes;
+
+  bool operator==(const PageHash &Other) const {
+    return std::memcmp(Bytes, Other.Bytes, sizeof(Bytes)) == 0;
+  }
+};
+
+/// computePageHashes - Compute the hash of each \p PageSize byte page of
+/// \p Data, the last page being possibly shorter, on \p NumThreads threads
+/// (0 means one per hardware thread).
+///
+/// If \p OldData and \p OldHashes describe a previous version of the same
+/// image, each page that is byte for byte the same as the page at the same
+/// offset of \p OldData takes its hash from \p OldHashes. Comparing a page is
+/// much cheaper than hashing it, so re-signing after a small change costs
+/// little more than reading the image.
+void computePageHashes(StringRef Data, unsigned PageSize,
+                       std::vector<PageHash> &Hashes, unsigned NumThreads = 0,
+                       StringRef OldData = StringRef(),
+                       ArrayRef<PageHash> OldHashes = ArrayRef<PageHash>());
+
+/// signAdHoc - Fill in the ad hoc signature of the Mach-O file at \p Path,
+/// whose LC_CODE_SIGNATURE space must already be reserved, with a code
+/// directory for \p Identifier. The signature blob is written in place; no
+/// other part of the file is rewritten. If \p OldPath names the image that
+/// was signed before this one was linked, its signature is used as above.
+error_code signAdHoc(StringRef Path, StringRef Identifier,
+                     StringRef OldPath = StringRef(), unsigned NumThreads = 0);
+
+}
+}
+
+#endif
@@ -0,0 +1,78 @@
+//===- MachOLinker.h - Static linker for Mach-O objects ---------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file declares a static linker for armv7 Mach-O executables and
+// dylibs, built on MachOObjectFile and the Mach-O relocation logic that
+// RuntimeDyldMachO uses. It is meant as a faster alternative to ld64 for the
+// common cases, not a replacement for all of it.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_OBJECT_MACHOLINKER_H
+#define LLVM_OBJECT_MACHOLINKER_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/DataTypes.h"
+#include "llvm/Support/MachO.h"
+#include "llvm/Support/system_error.h"
+
+namespace llvm {
+
+class raw_ostream;
+
+namespace object {
+
+/// MachOLinkOptions - The subset of ld64 options the linker understands.
+struct MachOLinkOptions {
+  /// The object files, archives and dylibs to link, in command line order.
+  /// Archive members are pulled in the way ld64 does, as undefined symbols
+  /// need them.
+  ArrayRef<StringRef> Inputs;
+  /// MH_EXECUTE or MH_DYLIB.
+  MachO::HeaderFileType OutputType;
+  /// The symbol the executable starts at (-e). Unused for a dylib.
+  StringRef EntrySymbol;
+  /// The install name of a dylib (-install_name).
+  StringRef InstallName;
+  /// The number of threads used to parse inputs and to apply relocations.
+  /// A value of 0 uses one thread per hardware thread.
+  unsigned NumThreads;
+  /// Where undefined and duplicate symbols are reported.
+  raw_ostream *Diagnostics;
+
+  MachOLinkOptions()
+    : OutputType(MachO::MH_EXECUTE), EntrySymbol("start"),
+      NumThreads(0), Diagnostics(nullptr) {}
+};
+
+/// linkMachO - Link \p Opts.Inputs into \p OutputPath.
+///
+/// The link runs in three phases, each spread over \p Opts.NumThreads
+/// threads:
+///  - the inputs are mapped and their symbol tables read in parallel, and
+///    the definitions are entered into a symbol table sharded by name hash,
+///    so threads only contend on the same shard. When several inputs define
+///    a symbol, the one first on the command line wins, as with ld64;
+///  - the sections are laid out serially, which is cheap;
+///  - each output section is copied into a FileOutputBuffer of the final
+///    size and has its relocations applied by its own task, so sections are
+///    written without locking.
+///
+/// The output is the same for any number of threads.
+///
+/// \returns make_error_code(object_error::parse_failed) if an input cannot
+/// be read, and an error if a symbol is undefined or defined twice. The
+/// details are written to Opts.Diagnostics.
+error_code linkMachO(const MachOLinkOptions &Opts, StringRef OutputPath);
+
+}
+}
+
+#endif
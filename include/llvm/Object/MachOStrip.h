@@ -0,0 +1,71 @@
+//===- MachOStrip.h - Remove symbols and sections from Mach-O ---*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file declares the library behind llvm-strip and llvm-nmedit for Mach-O
+// files: rewriting an object or a universal binary without some of its
+// symbols and debug sections.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_OBJECT_MACHOSTRIP_H
+#define LLVM_OBJECT_MACHOSTRIP_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/system_error.h"
+
+namespace llvm {
+namespace object {
+
+class MachOObjectFile;
+class MachOUniversalBinary;
+
+/// MachOStripOptions - What stripMachO removes, following the cctools strip
+/// flags of the same names.
+struct MachOStripOptions {
+  /// -S: remove the debugging symbols (stabs) and the __DWARF segment.
+  bool StripDebug;
+  /// -x: remove local symbols, keeping globals.
+  bool StripLocals;
+  /// -u: keep undefined symbols even when stripping everything else.
+  bool KeepUndefined;
+  /// If non-empty, like -s: keep exactly these global symbols, together with
+  /// the undefined symbols, and remove the rest.
+  ArrayRef<StringRef> KeepSymbols;
+  /// Like -R: remove these symbols.
+  ArrayRef<StringRef> RemoveSymbols;
+
+  MachOStripOptions()
+    : StripDebug(false), StripLocals(false), KeepUndefined(false) {}
+};
+
+/// stripMachO - Write \p Obj to \p OutputPath without the symbols and
+/// sections \p Opts removes.
+///
+/// The segments other than __LINKEDIT are copied once from the mapped input
+/// into a FileOutputBuffer of the final size. The symbol table, string table
+/// and indirect symbol table are rebuilt from the surviving symbols, and
+/// LC_SYMTAB, LC_DYSYMTAB and the __LINKEDIT segment command are updated to
+/// match. A signed image keeps its LC_CODE_SIGNATURE space but must be
+/// signed again.
+error_code stripMachO(const MachOObjectFile &Obj, const MachOStripOptions &Opts,
+                      StringRef OutputPath);
+
+/// stripMachOUniversal - Apply stripMachO to every slice of \p UB, using
+/// \p NumThreads threads, and write the resulting fat binary to
+/// \p OutputPath. The slices keep their order and alignment. A value of 0
+/// for \p NumThreads uses one thread per slice.
+error_code stripMachOUniversal(const MachOUniversalBinary &UB,
+                               const MachOStripOptions &Opts,
+                               StringRef OutputPath, unsigned NumThreads = 0);
+
+}
+}
+
+#endif
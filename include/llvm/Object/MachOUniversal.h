@@ -14,15 +14,19 @@
 #ifndef LLVM_OBJECT_MACHOUNIVERSAL_H
 #define LLVM_OBJECT_MACHOUNIVERSAL_H
 
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/ADT/Triple.h"
 #include "llvm/Object/Binary.h"
 #include "llvm/Support/ErrorOr.h"
 #include "llvm/Support/MachO.h"
+#include <memory>
 
 namespace llvm {
 namespace object {
 
+class MachOObjectFile;
 class ObjectFile;
 
 class MachOUniversalBinary : public Binary {
@@ -51,6 +55,24 @@ public:
 
     ObjectForArch getNext() const { return ObjectForArch(Parent, Index + 1); }
     uint32_t getCPUType() const { return Header.cputype; }
+    uint32_t getCPUSubType() const { return Header.cpusubtype; }
+    uint32_t getOffset() const { return Header.offset; }
+    uint32_t getSize() const { return Header.size; }
+    uint32_t getAlign() const { return Header.align; }
+
+    /// \brief Return the contents of this slice. The data aliases the
+    /// parent's buffer and is never copied.
+    StringRef getSliceData() const {
+      return Parent->getData().substr(Header.offset, Header.size);
+    }
+
+    /// \brief Create a MemoryBuffer referring to this slice without copying
+    /// it. The buffer must not outlive the parent universal binary.
+    error_code getAsMemoryBuffer(std::unique_ptr<MemoryBuffer> &Result) const;
+
+    /// \brief Write this slice to \p Path through a FileOutputBuffer, copying
+    /// directly from the parent's mapping.
+    error_code writeToFile(StringRef Path) const;
 
     error_code getAsObjectFile(std::unique_ptr<ObjectFile> &Result) const;
   };
@@ -95,8 +117,46 @@ public:
 
   error_code getObjectForArch(Triple::ArchType Arch,
                               std::unique_ptr<ObjectFile> &Result) const;
+
+  /// \brief Map only the slice for \p Arch of the universal binary open as
+  /// \p FD, using MemoryBuffer::getOpenFileSlice. Only the fat header and
+  /// the selected slice are read from disk.
+  static error_code getSliceFromFile(int FD, StringRef Path,
+                                     Triple::ArchType Arch,
+                                     std::unique_ptr<MemoryBuffer> &Result);
+
+  /// \brief Read the fat_arch entries of the universal binary open as \p FD,
+  /// reading only its header. This is what 'lipo -info' needs.
+  static error_code getArchsFromFile(int FD, StringRef Path,
+                                     SmallVectorImpl<MachO::fat_arch> &Archs);
 };
 
+/// \brief A thin Mach-O file to put in a universal binary.
+struct UniversalSlice {
+  /// The contents of the object, usually a mapping of the thin input file.
+  StringRef Data;
+  uint32_t CPUType;
+  uint32_t CPUSubType;
+  /// The slice's alignment, as a power of two.
+  uint32_t Align;
+
+  UniversalSlice(StringRef Data, uint32_t CPUType, uint32_t CPUSubType,
+                 uint32_t Align)
+    : Data(Data), CPUType(CPUType), CPUSubType(CPUSubType), Align(Align) {}
+
+  /// \brief Describe \p Obj as a slice, with the CPU type from its header and
+  /// the alignment lipo uses for that CPU: the page size, 2^14 for ARM64 and
+  /// 2^12 otherwise.
+  static UniversalSlice fromObject(const MachOObjectFile &Obj);
+};
+
+/// \brief Write a universal binary containing \p Slices, in the order given,
+/// to \p Path. Only the fat header is formatted; then each slice is copied
+/// from its mapping to its aligned offset in a FileOutputBuffer of the final
+/// size, on up to \p NumThreads threads (0 means one per slice).
+error_code writeUniversalBinary(ArrayRef<UniversalSlice> Slices, StringRef Path,
+                                unsigned NumThreads = 0);
+
 }
 }
 
@@ -13,7 +13,10 @@
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Option/OptSpecifier.h"
+#include "llvm/Option/Arg.h"
 #include "llvm/Option/Option.h"
+#include "llvm/Support/AlignOf.h"
+#include "llvm/Support/Allocator.h"
 #include <list>
 #include <string>
 #include <vector>
@@ -104,12 +107,25 @@ private:
   /// The internal list of arguments.
   arglist_type Args;
 
+  /// Storage for the Args owned by this list. They are destroyed, but not
+  /// individually freed, when the list is.
+  mutable BumpPtrAllocator ArgAllocator;
+
 protected:
   ArgList();
 
 public:
   virtual ~ArgList();
 
+  /// allocateArg - Return storage for one Arg that lives as long as this
+  /// list. OptTable::ParseArgs and the argument synthesis routines construct
+  /// the Args they create in it, so a command line with thousands of -I and
+  /// -D options costs a few slab allocations, not one heap allocation per
+  /// argument.
+  void *allocateArg() const {
+    return ArgAllocator.Allocate(sizeof(Arg), AlignOf<Arg>::Alignment);
+  }
+
   /// @name Arg Access
   /// @{
 
@@ -10,6 +10,8 @@
 #ifndef LLVM_OPTION_OPTTABLE_H
 #define LLVM_OPTION_OPTTABLE_H
 
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringSet.h"
 #include "llvm/Option/OptSpecifier.h"
 
@@ -65,6 +67,20 @@ private:
   StringSet<> PrefixesUnion;
   std::string PrefixChars;
 
+  /// Every spelling (prefix followed by name) of every searchable option,
+  /// mapped to the index of its first entry in OptionInfos. Built once by
+  /// the constructor, so ParseOneArg finds an option with a hash lookup per
+  /// candidate spelling instead of a binary search and a linear scan of
+  /// prefix matches.
+  StringMap<unsigned> SpellingIndex;
+
+  /// The distinct lengths of the spellings in SpellingIndex, longest first.
+  /// An argument is matched by looking up each of its prefixes of these
+  /// lengths, which finds the longest matching spelling, as the search did.
+  SmallVector<unsigned, 32> SpellingLengths;
+
+  void buildSpellingIndex();
+
 private:
   const Info &getInfo(OptSpecifier Opt) const {
     unsigned id = Opt.getID();
@@ -19,6 +19,7 @@
 #include "llvm/ProfileData/InstrProf.h"
 #include "llvm/Support/LineIterator.h"
 #include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/OnDiskHashTable.h"
 #include "llvm/Support/Endian.h"
 
 #include <iterator>
@@ -191,6 +192,113 @@ private:
 typedef RawInstrProfReader<uint32_t> RawInstrProfReader32;
 typedef RawInstrProfReader<uint64_t> RawInstrProfReader64;
 
+namespace IndexedInstrProf {
+/// Lookup trait for the function table of the indexed format. Each entry is
+/// keyed by function name, and its data is the function hash followed by the
+/// counters, all little endian 64 bit values.
+class InstrProfLookupTrait {
+  std::vector<uint64_t> CountBuffer;
+
+public:
+  typedef InstrProfRecord data_type;
+  typedef StringRef internal_key_type;
+  typedef StringRef external_key_type;
+  typedef uint64_t offset_type;
+
+  static bool EqualKey(StringRef A, StringRef B) { return A == B; }
+  static StringRef GetInternalKey(StringRef K) { return K; }
+  static StringRef GetExternalKey(StringRef K) { return K; }
+
+  static unsigned ComputeHash(StringRef K) {
+    return static_cast<unsigned>(ComputeHash64(K));
+  }
+  /// The hash the index is built with: the low 64 bits of the MD5 of the
+  /// name, so that it does not change with the host's string hashing.
+  static uint64_t ComputeHash64(StringRef K);
+
+  static std::pair<offset_type, offset_type>
+  ReadKeyDataLength(const unsigned char *&D) {
+    using namespace support;
+    offset_type KeyLen = endian::readNext<offset_type, little, unaligned>(D);
+    offset_type DataLen = endian::readNext<offset_type, little, unaligned>(D);
+    return std::make_pair(KeyLen, DataLen);
+  }
+
+  StringRef ReadKey(const unsigned char *D, offset_type N) {
+    return StringRef(reinterpret_cast<const char *>(D), N);
+  }
+
+  /// Decode the counters of \p K. Only the pages holding this entry are
+  /// touched; the returned record is valid until the next ReadData.
+  InstrProfRecord ReadData(StringRef K, const unsigned char *D,
+                           offset_type N) {
+    using namespace support;
+    InstrProfRecord Record;
+    Record.Name = K;
+    Record.Hash = 0;
+    if (N < sizeof(uint64_t) || N % sizeof(uint64_t))
+      return Record;
+    Record.Hash = endian::readNext<uint64_t, little, unaligned>(D);
+    CountBuffer.clear();
+    for (offset_type I = 1, E = N / sizeof(uint64_t); I != E; ++I)
+      CountBuffer.push_back(endian::readNext<uint64_t, little, unaligned>(D));
+    Record.Counts = CountBuffer;
+    return Record;
+  }
+};
+
+/// "\xfflprofi\x81" as a little endian integer.
+const uint64_t Magic = 0x8169666f72706cff;
+const uint64_t Version = 1;
+} // end namespace IndexedInstrProf
+
+typedef OnDiskIterableChainedHashTable<IndexedInstrProf::InstrProfLookupTrait>
+    InstrProfReaderIndex;
+
+/// Reader for the indexed binary instrprof format.
+///
+/// The file is a small header (magic, version, maximum function count and
+/// the offset of the hash table) followed by an OnDiskChainedHashTable of
+/// functions. It is used straight from the mapped buffer, so a compiler that
+/// looks up a few functions only reads the pages holding their buckets and
+/// entries, whatever the size of the profile.
+class IndexedInstrProfReader : public InstrProfReader {
+private:
+  /// The profile data file contents.
+  std::unique_ptr<MemoryBuffer> DataBuffer;
+  /// The function table.
+  std::unique_ptr<InstrProfReaderIndex> Index;
+  /// Iterator over the function table, for readNextRecord.
+  InstrProfReaderIndex::data_iterator RecordIterator;
+  /// The maximal execution count among all functions.
+  uint64_t MaxFunctionCount;
+
+  IndexedInstrProfReader(const IndexedInstrProfReader &) LLVM_DELETED_FUNCTION;
+  IndexedInstrProfReader &operator=(const IndexedInstrProfReader &)
+    LLVM_DELETED_FUNCTION;
+public:
+  IndexedInstrProfReader(std::unique_ptr<MemoryBuffer> DataBuffer)
+      : DataBuffer(std::move(DataBuffer)), MaxFunctionCount(0) {}
+
+  /// Return true if the given buffer is in an indexed instrprof format.
+  static bool hasFormat(const MemoryBuffer &DataBuffer);
+
+  /// Read the file header and set up the function table.
+  error_code readHeader() override;
+  /// Read a single record, in hash table order.
+  error_code readNextRecord(InstrProfRecord &Record) override;
+
+  /// Look up the counters of \p FuncName, without visiting other entries.
+  error_code getFunctionCounts(StringRef FuncName, uint64_t &FuncHash,
+                               std::vector<uint64_t> &Counts);
+  /// Return the maximum of all known function counts.
+  uint64_t getMaximumFunctionCount() { return MaxFunctionCount; }
+
+  /// Factory method to create an indexed reader.
+  static error_code create(std::string Path,
+                           std::unique_ptr<IndexedInstrProfReader> &Result);
+};
+
 } // end namespace llvm
 
 #endif // LLVM_PROFILEDATA_INSTRPROF_READER_H_
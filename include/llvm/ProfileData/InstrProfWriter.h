@@ -40,7 +40,12 @@ public:
   /// summed.
   error_code addFunctionCounts(StringRef FunctionName, uint64_t FunctionHash,
                                ArrayRef<uint64_t> Counters);
-  /// Ensure that all data is written to disk.
+  /// Add all the counts of \p Other, as if each of its functions had been
+  /// added with addFunctionCounts. llvm-profdata merges raw profiles on
+  /// separate threads into separate writers and then merges the writers.
+  error_code mergeFrom(const InstrProfWriter &Other);
+  /// Write the profile in the indexed format read by IndexedInstrProfReader.
+  /// Functions are written to an OnDiskChainedHashTable keyed by name.
   void write(raw_ostream &OS);
 };
 
@@ -145,11 +145,12 @@ public:
                 "allocation.");
 
   BumpPtrAllocatorImpl()
-      : CurPtr(nullptr), End(nullptr), BytesAllocated(0), Allocator() {}
+      : CurPtr(nullptr), End(nullptr), BytesAllocated(0), TailBytesWasted(0),
+        SlabSizeShift(0), Allocator() {}
   template <typename T>
   BumpPtrAllocatorImpl(T &&Allocator)
-      : CurPtr(nullptr), End(nullptr), BytesAllocated(0),
-        Allocator(std::forward<T &&>(Allocator)) {}
+      : CurPtr(nullptr), End(nullptr), BytesAllocated(0), TailBytesWasted(0),
+        SlabSizeShift(0), Allocator(std::forward<T &&>(Allocator)) {}
 
   // Manually implement a move constructor as we must clear the old allocators
   // slabs as a matter of correctness.
@@ -157,9 +158,12 @@ public:
       : CurPtr(Old.CurPtr), End(Old.End), Slabs(std::move(Old.Slabs)),
         CustomSizedSlabs(std::move(Old.CustomSizedSlabs)),
         BytesAllocated(Old.BytesAllocated),
+        TailBytesWasted(Old.TailBytesWasted),
+        SlabSizeShift(Old.SlabSizeShift),
         Allocator(std::move(Old.Allocator)) {
     Old.CurPtr = Old.End = nullptr;
     Old.BytesAllocated = 0;
+    Old.TailBytesWasted = 0;
     Old.Slabs.clear();
     Old.CustomSizedSlabs.clear();
   }
@@ -176,12 +180,15 @@ public:
     CurPtr = RHS.CurPtr;
     End = RHS.End;
     BytesAllocated = RHS.BytesAllocated;
+    TailBytesWasted = RHS.TailBytesWasted;
+    SlabSizeShift = RHS.SlabSizeShift;
     Slabs = std::move(RHS.Slabs);
     CustomSizedSlabs = std::move(RHS.CustomSizedSlabs);
     Allocator = std::move(RHS.Allocator);
 
     RHS.CurPtr = RHS.End = nullptr;
     RHS.BytesAllocated = 0;
+    RHS.TailBytesWasted = 0;
     RHS.Slabs.clear();
     RHS.CustomSizedSlabs.clear();
     return *this;
@@ -195,8 +202,9 @@ public:
 
     // Reset the state.
     BytesAllocated = 0;
+    TailBytesWasted = 0;
     CurPtr = (char *)Slabs.front();
-    End = CurPtr + SlabSize;
+    End = CurPtr + computeSlabSize(0);
 
     // Deallocate all but the first slab, and all custome sized slabs.
     DeallocateSlabs(std::next(Slabs.begin()), Slabs.end());
@@ -270,6 +278,24 @@ public:
     return TotalMemory;
   }
 
+  /// \brief The number of bytes handed out so far.
+  size_t getBytesAllocated() const { return BytesAllocated; }
+
+  /// \brief The number of bytes left unused at the end of slabs that were
+  /// abandoned because an allocation did not fit.
+  size_t getTailBytesWasted() const { return TailBytesWasted; }
+
+  /// \brief Scale every slab by 2^\p Shift.
+  ///
+  /// Clients that allocate a great deal, such as the AST of a very large
+  /// translation unit, can use larger slabs to reduce the number of calls to
+  /// the underlying allocator. Must be called before the first allocation.
+  void setSlabSizeShift(unsigned Shift) {
+    assert(Slabs.empty() && "Slab size changed after allocating");
+    SlabSizeShift = Shift;
+  }
+  unsigned getSlabSizeShift() const { return SlabSizeShift; }
+
   void PrintStats() const {
     detail::printBumpPtrAllocatorStats(Slabs.size(), BytesAllocated,
                                        getTotalMemory());
@@ -295,21 +321,30 @@ private:
   /// Used so that we can compute how much space was wasted.
   size_t BytesAllocated;
 
+  /// \brief How many bytes were left at the end of abandoned slabs.
+  size_t TailBytesWasted;
+
+  /// \brief The log2 of the factor by which every slab is scaled.
+  unsigned SlabSizeShift;
+
   /// \brief The allocator instance we use to get slabs of memory.
   AllocatorT Allocator;
 
-  static size_t computeSlabSize(unsigned SlabIdx) {
+  size_t computeSlabSize(unsigned SlabIdx) const {
     // Scale the actual allocated slab size based on the number of slabs
     // allocated. Every 128 slabs allocated, we double the allocated size to
     // reduce allocation frequency, but saturate at multiplying the slab size by
     // 2^30.
-    return SlabSize * ((size_t)1 << std::min<size_t>(30, SlabIdx / 128));
+    return (SlabSize << SlabSizeShift) *
+           ((size_t)1 << std::min<size_t>(30, SlabIdx / 128));
   }
 
   /// \brief Allocate a new slab and move the bump pointers over into the new
   /// slab, modifying CurPtr and End.
   void StartNewSlab() {
     size_t AllocatedSlabSize = computeSlabSize(Slabs.size());
+    if (CurPtr)
+      TailBytesWasted += End - CurPtr;
 
     void *NewSlab = Allocator.Allocate(AllocatedSlabSize, 0);
     Slabs.push_back(NewSlab);
@@ -386,7 +421,7 @@ public:
 
     for (auto I = Allocator.Slabs.begin(), E = Allocator.Slabs.end(); I != E;
          ++I) {
-      size_t AllocatedSlabSize = BumpPtrAllocator::computeSlabSize(
+      size_t AllocatedSlabSize = Allocator.computeSlabSize(
           std::distance(Allocator.Slabs.begin(), I));
       char *Begin = alignPtr((char *)*I, alignOf<T>());
       char *End = *I == Allocator.Slabs.back() ? Allocator.CurPtr
@@ -17,11 +17,10 @@
 #include "llvm/Support/DataTypes.h"
 #include <memory>
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringRef.h"
 
 namespace llvm {
 
-class StringRef;
-
 namespace zlib {
 
 enum CompressionLevel {
@@ -51,6 +50,41 @@ Status uncompress(StringRef InputBuffer,
 
 uint32_t crc32(StringRef Buffer);
 
+/// Compressed debug sections start with the magic "ZLIB" followed by the
+/// uncompressed size as a 64-bit big-endian integer, then the zlib stream.
+/// This is the layout used for ELF .zdebug_* sections, and for the Mach-O
+/// __zdebug_* sections in the __DWARF segment.
+const unsigned DebugSectionHeaderSize = 12;
+
+/// Return true if \p Contents starts with a compressed debug section header.
+inline bool isCompressedDebugSection(StringRef Contents) {
+  return Contents.size() >= DebugSectionHeaderSize &&
+         Contents.startswith("ZLIB");
+}
+
+/// Return the uncompressed size recorded in the header of \p Contents, which
+/// must satisfy isCompressedDebugSection().
+inline uint64_t getUncompressedDebugSectionSize(StringRef Contents) {
+  uint64_t Size = 0;
+  for (unsigned I = 4; I != DebugSectionHeaderSize; ++I)
+    Size = (Size << 8) | static_cast<unsigned char>(Contents[I]);
+  return Size;
+}
+
+/// Compress the contents of a debug section, prepending the header.
+Status compressDebugSection(StringRef Contents,
+                            SmallVectorImpl<char> &CompressedSection,
+                            CompressionLevel Level = DefaultCompression);
+
+/// Decompress a section produced by compressDebugSection().
+inline Status uncompressDebugSection(StringRef Contents,
+                                     SmallVectorImpl<char> &Uncompressed) {
+  if (!isCompressedDebugSection(Contents))
+    return StatusInvalidData;
+  return uncompress(Contents.substr(DebugSectionHeaderSize), Uncompressed,
+                    getUncompressedDebugSectionSize(Contents));
+}
+
 }  // End of namespace zlib
 
 } // End of namespace llvm
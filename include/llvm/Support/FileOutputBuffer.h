@@ -19,8 +19,10 @@
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/DataTypes.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/raw_ostream.h"
 
 namespace llvm {
+class CrashRecoveryContextCleanup;
 class error_code;
 
 /// FileOutputBuffer - This interface provides simple way to create an in-memory
@@ -40,6 +42,12 @@ public:
   /// Factory method to create an OutputBuffer object which manages a read/write
   /// buffer of the specified size. When committed, the buffer will be written
   /// to the file at the specified path.
+  ///
+  /// The buffer is a mapping of a uniquely named temporary file next to the
+  /// final path, and commit renames it into place, so concurrent readers and
+  /// parallel builds never see a torn file. The temporary file is removed if
+  /// the process is killed by a signal, and, when created inside a
+  /// CrashRecoveryContext, if that context recovers from a crash.
   static error_code create(StringRef FilePath, size_t Size,
                            OwningPtr<FileOutputBuffer> &Result,
                            unsigned Flags = 0);
@@ -67,6 +75,11 @@ public:
     return FinalPath;
   }
 
+  /// Grow the buffer to \p NewSize bytes, for writers that do not know the
+  /// final size up front. The contents are kept, but the buffer may move, so
+  /// pointers from getBufferStart and getBufferEnd are invalidated.
+  error_code resize(size_t NewSize);
+
   /// Flushes the content of the buffer to its file and deallocates the
   /// buffer.  If commit() is not called before this object's destructor
   /// is called, the file is deleted in the destructor. The optional parameter
@@ -89,6 +102,37 @@ private:
   std::unique_ptr<llvm::sys::fs::mapped_file_region> Region;
   SmallString<128>    FinalPath;
   SmallString<128>    TempPath;
+  unsigned            Flags;
+  CrashRecoveryContextCleanup *Cleanup;
+};
+
+/// raw_file_output_buffer_ostream - A raw_ostream that writes straight into a
+/// FileOutputBuffer, growing it geometrically as needed. This gives tools
+/// that stream their output, with no size known in advance, the same atomic
+/// commit as FileOutputBuffer and saves the copy through a stream buffer.
+class raw_file_output_buffer_ostream : public raw_ostream {
+  std::unique_ptr<FileOutputBuffer> Buffer;
+  uint64_t Pos;
+  error_code EC;
+
+  /// write_impl - See raw_ostream::write_impl.
+  void write_impl(const char *Ptr, size_t Size) override;
+
+  /// current_pos - See raw_ostream::current_pos.
+  uint64_t current_pos() const override { return Pos; }
+
+public:
+  /// Create a temporary for \p FilePath, as FileOutputBuffer::create does.
+  /// On failure \p EC is set and the stream discards its output.
+  raw_file_output_buffer_ostream(StringRef FilePath, error_code &EC,
+                                 unsigned Flags = 0);
+
+  /// If commit was not called, the temporary is removed.
+  ~raw_file_output_buffer_ostream();
+
+  /// commit - Flush the stream, trim the file to what was written and rename
+  /// it into place. Returns the first error from any step.
+  error_code commit();
 };
 } // end namespace llvm
 
@@ -37,9 +37,10 @@ namespace GCOV {
 
 /// GCOVOptions - A struct for passing gcov options between functions.
 struct GCOVOptions {
-  GCOVOptions(bool A, bool B, bool C, bool F, bool P, bool U)
+  GCOVOptions(bool A, bool B, bool C, bool F, bool P, bool U, bool N = false,
+              unsigned T = 1)
       : AllBlocks(A), BranchInfo(B), BranchCount(C), FuncCoverage(F),
-        PreservePaths(P), UncondBranch(U) {}
+        PreservePaths(P), UncondBranch(U), NoOutput(N), NumThreads(T) {}
 
   bool AllBlocks;
   bool BranchInfo;
@@ -47,6 +48,11 @@ struct GCOVOptions {
   bool FuncCoverage;
   bool PreservePaths;
   bool UncondBranch;
+  /// Only print the coverage summaries. No .gcov files are written and no
+  /// source file is read.
+  bool NoOutput;
+  /// Number of threads FileInfo::print uses to annotate source files.
+  unsigned NumThreads;
 };
 
 /// GCOVBuffer - A wrapper around MemoryBuffer to provide GCOV specific
@@ -386,8 +392,19 @@ public:
   }
   void setRunCount(uint32_t Runs) { RunCount = Runs; }
   void setProgramCount(uint32_t Programs) { ProgramCount = Programs; }
+
+  /// print - Write a .gcov file for each source file and print the coverage
+  /// summaries. Source files are memory mapped and annotated on
+  /// Options.NumThreads threads, each into its own output file; the
+  /// summaries are always printed in source file order.
   void print(StringRef GCNOFile, StringRef GCDAFile);
 private:
+  /// printSourceFile - Write the .gcov file of \p Filename and compute its
+  /// coverage in \p Coverage. Safe to call concurrently for different files.
+  void printSourceFile(StringRef Filename, const LineData &Line,
+                       StringRef GCNOFile, StringRef GCDAFile,
+                       GCOVCoverage &Coverage);
+
   void printFunctionSummary(raw_fd_ostream &OS,
                             const FunctionVector &Funcs) const;
   void printBlockInfo(raw_fd_ostream &OS, const GCOVBlock &Block,
@@ -77,7 +77,26 @@ public:
   operator LockFileState() const { return getState(); }
 
   /// \brief For a shared lock, wait until the owner releases the lock.
+  ///
+  /// The wait blocks on a change notification for the directory containing
+  /// the lock file where the host supports one, and falls back to polling
+  /// with exponential backoff otherwise.
   WaitForUnlockResult waitForUnlock();
+
+  /// \brief Atomically publish \p TempFileName as \p FileName.
+  ///
+  /// The temporary file must be in the same directory as the destination.
+  /// If another process already published the destination, the temporary
+  /// file is removed and the existing file is kept, so readers always see
+  /// one complete file. Processes blocked in waitForUnlock() on the
+  /// destination are woken up.
+  static error_code publishFile(StringRef TempFileName, StringRef FileName);
+
+private:
+  /// \brief Block until the directory of \p FileName changes or
+  /// \p TimeoutMs milliseconds elapse. Returns false if change notifications
+  /// are not available on this host.
+  static bool waitForDirectoryChange(StringRef FileName, unsigned TimeoutMs);
 };
 
 } // end namespace llvm
@@ -24,6 +24,7 @@
 namespace llvm {
 
 class error_code;
+class raw_ostream;
 template<class T> class OwningPtr;
 
 /// MemoryBuffer - This interface provides simple read-only access to a block
@@ -150,6 +151,31 @@ public:
   /// Return information on the memory mechanism used to support the
   /// MemoryBuffer.
   virtual BufferKind getBufferKind() const = 0;  
+
+  /// setMapThreshold - Set the size from which getFile and getOpenFile map a
+  /// file instead of reading it into the heap. The default is 16KB, the
+  /// historical heuristic. Read-only mappings share pages with the OS file
+  /// cache, so on hosts that run many compiles at once (on Windows, where
+  /// a mapping is a CreateFileMapping section shared by every process that
+  /// maps the file) a lower threshold saves memory. A file whose size is a
+  /// multiple of the page size is still read when a null terminator is
+  /// required, since there is no byte past its end to map.
+  static void setMapThreshold(size_t Size);
+  static size_t getMapThreshold();
+
+  /// Statistics on how getFile and getOpenFile backed their buffers, over
+  /// every buffer opened so far. The counters are updated atomically.
+  struct Statistics {
+    uint64_t NumMapped;   ///< Files that were mapped.
+    uint64_t MappedBytes; ///< Bytes in those files.
+    uint64_t NumRead;     ///< Files that were read into the heap.
+    uint64_t ReadBytes;   ///< Bytes in those files.
+  };
+  static Statistics getStatistics();
+
+  /// printStatistics - Print getStatistics() in the form used by
+  /// -print-stats.
+  static void printStatistics(raw_ostream &OS);
 };
 
 // Create wrappers for C Binding types (see CBindingWrapping.h).
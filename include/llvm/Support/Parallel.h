@@ -0,0 +1,196 @@
+//===- llvm/Support/Parallel.h - Parallel algorithms ------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file defines parallel_for, parallel_for_each, parallel_sort and
+// parallel_reduce, which split their range into chunks and run the chunks as
+// tasks of ThreadPool::getDefault(). Each takes the same arguments as its
+// serial counterpart and gives the same result, provided the callbacks are
+// safe to run concurrently.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_SUPPORT_PARALLEL_H
+#define LLVM_SUPPORT_PARALLEL_H
+
+#include "llvm/Support/ThreadPool.h"
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+namespace llvm {
+
+namespace detail {
+/// Ranges shorter than this are not worth a task of their own.
+const ptrdiff_t MinParallelSize = 1024;
+
+/// The number of chunks to cut \p N items into: enough for load balancing
+/// across the pool, few enough that each is worth scheduling.
+inline size_t getNumChunks(size_t N, size_t MinChunk) {
+  size_t Chunks = ThreadPool::getDefault().getThreadCount() * 4;
+  if (MinChunk > 1)
+    Chunks = std::min(Chunks, N / MinChunk);
+  return std::max<size_t>(1, std::min(Chunks, N));
+}
+
+/// Cut the \p N items starting at \p Begin into \p Chunks ranges of nearly
+/// equal size, returning the Chunks + 1 iterators that bound them. This
+/// walks the range once unless IterTy is random access.
+template <class IterTy>
+std::vector<IterTy> getChunkBounds(IterTy Begin, size_t N, size_t Chunks) {
+  std::vector<IterTy> Bounds;
+  Bounds.reserve(Chunks + 1);
+  Bounds.push_back(Begin);
+  size_t PerChunk = N / Chunks, Extra = N % Chunks;
+  for (size_t C = 0; C != Chunks; ++C) {
+    std::advance(Begin, PerChunk + (C < Extra));
+    Bounds.push_back(Begin);
+  }
+  return Bounds;
+}
+
+template <class RandomAccessIterator, class Comparator>
+void parallel_quick_sort(RandomAccessIterator Start, RandomAccessIterator End,
+                         const Comparator &Comp, TaskGroup &TG,
+                         unsigned Depth) {
+  // Sort small ranges, and give up splitting when the pivots keep being
+  // poor, where std::sort falls back to heap sort on its own.
+  if (End - Start < MinParallelSize || Depth == 0) {
+    std::sort(Start, End, Comp);
+    return;
+  }
+
+  // Median of three pivot, moved to the end of the range.
+  RandomAccessIterator Mid = Start + (End - Start) / 2;
+  if (Comp(*Mid, *Start))
+    std::iter_swap(Mid, Start);
+  if (Comp(*(End - 1), *Mid)) {
+    std::iter_swap(End - 1, Mid);
+    if (Comp(*Mid, *Start))
+      std::iter_swap(Mid, Start);
+  }
+  std::iter_swap(Mid, End - 1);
+  RandomAccessIterator Pivot = End - 1;
+  RandomAccessIterator Split = std::partition(
+      Start, Pivot,
+      [&](decltype(*Start) V) { return Comp(V, *Pivot); });
+  std::iter_swap(Split, Pivot);
+
+  TG.spawn([=, &Comp, &TG] {
+    parallel_quick_sort(Start, Split, Comp, TG, Depth - 1);
+  });
+  parallel_quick_sort(Split + 1, End, Comp, TG, Depth - 1);
+}
+} // end namespace detail
+
+/// parallel_for - Call \p Fn(I) for every I in [Begin, End). Ranges are
+/// only split into chunks of at least \p MinChunk indices, so pass a smaller
+/// value when each call does a lot of work.
+template <class IndexTy, class FuncTy>
+void parallel_for(IndexTy Begin, IndexTy End, FuncTy Fn,
+                  size_t MinChunk = detail::MinParallelSize) {
+  if (End <= Begin)
+    return;
+  size_t N = End - Begin;
+  size_t Chunks = detail::getNumChunks(N, MinChunk);
+  if (Chunks == 1) {
+    for (IndexTy I = Begin; I != End; ++I)
+      Fn(I);
+    return;
+  }
+  size_t PerChunk = (N + Chunks - 1) / Chunks;
+  TaskGroup TG;
+  for (IndexTy I = Begin; I < End; I += PerChunk) {
+    IndexTy E = std::min<IndexTy>(End, I + PerChunk);
+    TG.spawn([=, &Fn] {
+      for (IndexTy J = I; J != E; ++J)
+        Fn(J);
+    });
+  }
+  TG.wait();
+}
+
+/// parallel_for_each - Call \p Fn on every element of [Begin, End), which
+/// must be a forward iterator range. As with parallel_for, \p MinChunk is the
+/// smallest number of elements worth a task.
+template <class IterTy, class FuncTy>
+void parallel_for_each(IterTy Begin, IterTy End, FuncTy Fn,
+                       size_t MinChunk = detail::MinParallelSize) {
+  size_t N = std::distance(Begin, End);
+  size_t Chunks = detail::getNumChunks(N, MinChunk);
+  if (Chunks <= 1) {
+    std::for_each(Begin, End, Fn);
+    return;
+  }
+  std::vector<IterTy> Bounds = detail::getChunkBounds(Begin, N, Chunks);
+  TaskGroup TG;
+  for (size_t C = 0; C != Chunks; ++C) {
+    IterTy First = Bounds[C], Last = Bounds[C + 1];
+    TG.spawn([=, &Fn] { std::for_each(First, Last, Fn); });
+  }
+  TG.wait();
+}
+
+/// parallel_sort - Sort [Start, End) with \p Comp. Like std::sort, it is not
+/// stable.
+template <class RandomAccessIterator, class Comparator>
+void parallel_sort(RandomAccessIterator Start, RandomAccessIterator End,
+                   const Comparator &Comp) {
+  TaskGroup TG;
+  // Bound the recursion at twice the log of the size.
+  unsigned Depth = 0;
+  for (ptrdiff_t N = End - Start; N > 1; N >>= 1)
+    Depth += 2;
+  detail::parallel_quick_sort(Start, End, Comp, TG, Depth);
+  TG.wait();
+}
+
+template <class RandomAccessIterator>
+void parallel_sort(RandomAccessIterator Start, RandomAccessIterator End) {
+  parallel_sort(Start, End,
+                std::less<typename std::iterator_traits<
+                    RandomAccessIterator>::value_type>());
+}
+
+/// parallel_reduce - Combine \p Init and \p Map(X) for every X in the
+/// forward iterator range [Begin, End) with \p Reduce, which must be
+/// associative. \p Init must be its identity, since it is used once per
+/// chunk.
+template <class IterTy, class ResultTy, class ReduceFuncTy, class MapFuncTy>
+ResultTy parallel_reduce(IterTy Begin, IterTy End, ResultTy Init,
+                         ReduceFuncTy Reduce, MapFuncTy Map) {
+  size_t N = std::distance(Begin, End);
+  size_t Chunks = detail::getNumChunks(N, detail::MinParallelSize);
+  if (Chunks <= 1) {
+    for (; Begin != End; ++Begin)
+      Init = Reduce(Init, Map(*Begin));
+    return Init;
+  }
+  std::vector<IterTy> Bounds = detail::getChunkBounds(Begin, N, Chunks);
+  std::vector<ResultTy> Results(Chunks, Init);
+  TaskGroup TG;
+  for (size_t C = 0; C != Chunks; ++C) {
+    IterTy First = Bounds[C], Last = Bounds[C + 1];
+    TG.spawn([=, &Results, &Reduce, &Map] {
+      ResultTy R = Results[C];
+      for (IterTy I = First; I != Last; ++I)
+        R = Reduce(R, Map(*I));
+      Results[C] = R;
+    });
+  }
+  TG.wait();
+  // Combine in chunk order so the result does not depend on scheduling.
+  for (size_t C = 0; C != Chunks; ++C)
+    Init = Reduce(Init, Results[C]);
+  return Init;
+}
+
+} // end namespace llvm
+
+#endif
@@ -150,6 +150,12 @@ public:
   /// allocated space.
   static size_t GetMallocUsage();
 
+  /// \brief Return the peak resident set size of the process, in bytes.
+  /// This is the largest amount of physical memory the process has used so
+  /// far (getrusage's ru_maxrss, or PeakWorkingSetSize on Windows), or 0 if
+  /// the operating system does not report it.
+  static size_t GetPeakRSS();
+
   /// This static function will set \p user_time to the amount of CPU time
   /// spent in user (non-kernel) mode and \p sys_time to the amount of CPU
   /// time spent in system (kernel) mode.  If the operating system does not
@@ -77,6 +77,13 @@ struct ProcessInfo {
   /// This function waits for the program to finish, so should be avoided in
   /// library functions that aren't expected to block. Consider using
   /// ExecuteNoWait() instead.
+  ///
+  /// On Cygwin, fork copies the whole address space of the caller, which is
+  /// slow for a process as large as the clang driver. When HAVE_SPAWNVE is
+  /// defined and no memoryLimit is given, the child is started with spawnve
+  /// instead, which creates it directly with CreateProcess. The redirects
+  /// are applied by duplicating the descriptors around the call. Windows
+  /// hosts always use CreateProcess.
   /// @returns an integer result code indicating the status of the program.
   /// A zero or positive value indicates the result code of the program.
   /// -1 indicates failure to execute
@@ -113,7 +120,8 @@ struct ProcessInfo {
       ///< program.
       bool *ExecutionFailed = nullptr);
 
-  /// Similar to ExecuteAndWait, but returns immediately.
+  /// Similar to ExecuteAndWait, but returns immediately. It takes the same
+  /// spawnve fast path on Cygwin.
   /// @returns The \see ProcessInfo of the newly launced process.
   /// \note On Microsoft Windows systems, users will need to either call \see
   /// Wait until the process finished execution or win32 CloseHandle() API on
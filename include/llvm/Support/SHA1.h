@@ -0,0 +1,61 @@
+//===- llvm/Support/SHA1.h - SHA-1 message digest ---------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file declares an incremental SHA-1 (FIPS 180-4), the hash Mach-O code
+// signatures use for their page hashes.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_SUPPORT_SHA1_H
+#define LLVM_SUPPORT_SHA1_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/DataTypes.h"
+
+namespace llvm {
+
+class SHA1 {
+  uint32_t State[5];
+  uint8_t Buffer[64];
+  uint64_t Length;
+  unsigned BufferUsed;
+
+public:
+  typedef uint8_t SHA1Result[20];
+
+  SHA1() { init(); }
+
+  /// \brief Resets the hash to the empty message.
+  void init();
+
+  /// \brief Updates the hash for the byte stream provided.
+  void update(ArrayRef<uint8_t> Data);
+
+  /// \brief Updates the hash for the StringRef provided.
+  void update(StringRef Str);
+
+  /// \brief Finishes off the hash and puts the result in \p Result.
+  void final(SHA1Result &Result);
+
+  /// \brief Computes the hash of \p Data in one call.
+  static void hash(ArrayRef<uint8_t> Data, SHA1Result &Result);
+
+  /// \brief Whether the block function uses the x86 SHA extensions. They are
+  /// detected once at startup and used when both the host and the compiler
+  /// building LLVM support them; otherwise a portable implementation is used.
+  static bool usesHardwareAcceleration();
+
+private:
+  void processBlocks(const uint8_t *Data, size_t NumBlocks);
+};
+
+}
+
+#endif
@@ -0,0 +1,68 @@
+//===- llvm/Support/StringSaver.h - Arena-backed string storage -*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file declares StringSaver and UniqueStringSaver, which copy strings
+// into a BumpPtrAllocator so that they live as long as the allocator, without
+// a heap allocation or a free per string.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_SUPPORT_STRINGSAVER_H
+#define LLVM_SUPPORT_STRINGSAVER_H
+
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/Allocator.h"
+#include <cstring>
+
+namespace llvm {
+
+/// StringSaver - Copies strings into an arena. The copies are null
+/// terminated, so data() can be passed to C APIs.
+class StringSaver {
+  BumpPtrAllocator &Alloc;
+
+public:
+  explicit StringSaver(BumpPtrAllocator &Alloc) : Alloc(Alloc) {}
+
+  StringRef save(StringRef S) {
+    char *P = static_cast<char *>(Alloc.Allocate(S.size() + 1, 1));
+    if (!S.empty())
+      memcpy(P, S.data(), S.size());
+    P[S.size()] = 0;
+    return StringRef(P, S.size());
+  }
+
+  BumpPtrAllocator &getAllocator() const { return Alloc; }
+};
+
+/// UniqueStringSaver - Interns strings: saving the same contents twice
+/// returns the same copy, so interned strings can be compared and hashed by
+/// their data pointer.
+///
+/// The table's entries and the strings themselves both live in the arena,
+/// which is what makes interning millions of symbol names cheap; nothing is
+/// freed until the allocator is destroyed or reset.
+class UniqueStringSaver {
+  StringMap<char, BumpPtrAllocator &> Strings;
+
+public:
+  explicit UniqueStringSaver(BumpPtrAllocator &Alloc) : Strings(Alloc) {}
+
+  /// save - Return the interned copy of \p S, which is null terminated.
+  StringRef save(StringRef S) {
+    return Strings.GetOrCreateValue(S).getKey();
+  }
+
+  unsigned size() const { return Strings.size(); }
+};
+
+} // end namespace llvm
+
+#endif
@@ -0,0 +1,175 @@
+//===-- llvm/Support/ThreadPool.h - A pool of worker threads ----*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file declares ThreadPool, a fixed set of worker threads that run
+// tasks queued with async(), and TaskGroup, which waits for a set of tasks.
+// The parallel algorithms in llvm/Support/Parallel.h are built on them.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_SUPPORT_THREADPOOL_H
+#define LLVM_SUPPORT_THREADPOOL_H
+
+#include "llvm/Config/llvm-config.h"
+#include "llvm/Support/Compiler.h"
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <vector>
+
+#if LLVM_ENABLE_THREADS
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace llvm {
+
+/// ThreadPool - Runs tasks on a fixed number of threads.
+///
+/// Each worker owns a queue. A task queued from a worker goes to the front
+/// of that worker's queue, so nested parallelism stays on the thread whose
+/// caches hold its data, and a worker whose queue is empty steals from the
+/// back of another's. Tasks queued from other threads are spread round
+/// robin.
+///
+/// The pool uses the C++11 thread library, i.e. pthreads everywhere but
+/// MSVC, including Cygwin and MinGW through winpthreads. When LLVM is built
+/// without threads, async() runs the task immediately on the calling thread.
+class ThreadPool {
+public:
+  typedef std::function<void()> TaskTy;
+
+  /// Create a pool of \p NumThreads workers; 0 means one per hardware
+  /// thread.
+  explicit ThreadPool(unsigned NumThreads = 0);
+
+  /// Waits for the queued tasks to finish, then joins the workers.
+  ~ThreadPool();
+
+  /// Queue \p Task to run on some worker.
+  void async(TaskTy Task);
+
+  /// Run one queued task on the calling thread, if there is one. Returns
+  /// false if every queue was empty. Used by threads that wait for other
+  /// tasks, so that waiting from inside a task cannot deadlock the pool.
+  bool runPendingTask();
+
+  /// Block until every task queued so far, and every task they queue, has
+  /// finished. The calling thread runs tasks while it waits.
+  void wait();
+
+  unsigned getThreadCount() const { return NumThreads; }
+
+  /// The pool shared by the parallel algorithms, created on first use with
+  /// one thread per hardware thread.
+  static ThreadPool &getDefault();
+
+private:
+  ThreadPool(const ThreadPool &) LLVM_DELETED_FUNCTION;
+  void operator=(const ThreadPool &) LLVM_DELETED_FUNCTION;
+
+  unsigned NumThreads;
+  /// Tasks queued or running.
+  std::atomic<unsigned> ActiveTasks;
+
+#if LLVM_ENABLE_THREADS
+  struct WorkQueue {
+    std::mutex Lock;
+    std::deque<TaskTy> Tasks;
+  };
+  std::vector<std::thread> Threads;
+  std::vector<WorkQueue *> Queues;
+  std::atomic<unsigned> NextQueue;
+
+  /// Workers sleep on this when there is nothing to run or to steal.
+  std::mutex SleepLock;
+  std::condition_variable WorkAvailable;
+  std::condition_variable AllDone;
+  bool Stopping;
+
+  void workerLoop(unsigned Index);
+  bool popTask(unsigned Index, TaskTy &Task);
+#endif
+};
+
+/// TaskGroup - Spawns tasks into a ThreadPool and waits for just those.
+///
+/// \code
+///   TaskGroup TG;
+///   TG.spawn([&] { codegen(PartA); });
+///   TG.spawn([&] { codegen(PartB); });
+///   TG.wait();
+/// \endcode
+class TaskGroup {
+  ThreadPool &Pool;
+  std::atomic<unsigned> Pending;
+#if LLVM_ENABLE_THREADS
+  /// Guards the decrements of Pending, so that wait() cannot miss the
+  /// notification of a task that finishes while it is going to sleep, and
+  /// cannot return, letting the group be destroyed, while a task still holds
+  /// it.
+  std::mutex Lock;
+  /// Signalled each time one of the group's tasks finishes.
+  std::condition_variable TaskDone;
+#endif
+
+  TaskGroup(const TaskGroup &) LLVM_DELETED_FUNCTION;
+  void operator=(const TaskGroup &) LLVM_DELETED_FUNCTION;
+
+public:
+  explicit TaskGroup(ThreadPool &Pool = ThreadPool::getDefault())
+    : Pool(Pool), Pending(0) {}
+  ~TaskGroup() { wait(); }
+
+  void spawn(std::function<void()> F) {
+    ++Pending;
+    Pool.async([this, F] {
+      F();
+#if LLVM_ENABLE_THREADS
+      // Notify while holding Lock: wait() only sees Pending reach 0 once the
+      // lock is released, so the unlock is the task's last access to the
+      // group.
+      std::lock_guard<std::mutex> Guard(Lock);
+      --Pending;
+      TaskDone.notify_all();
+#else
+      --Pending;
+#endif
+    });
+  }
+
+  /// Wait for the spawned tasks, running queued tasks meanwhile. It is safe
+  /// to call from inside a task of the same pool. When there is nothing to
+  /// run, every remaining task of the group is already running on another
+  /// thread, so this one sleeps until they have all finished.
+  void wait() {
+#if LLVM_ENABLE_THREADS
+    std::unique_lock<std::mutex> Guard(Lock);
+    while (Pending != 0) {
+      // Run queued work without holding Lock, so that the tasks it finishes
+      // can update Pending.
+      Guard.unlock();
+      bool Ran = Pool.runPendingTask();
+      Guard.lock();
+      if (!Ran)
+        TaskDone.wait(Guard, [&] { return Pending == 0; });
+    }
+#else
+    while (Pending != 0 && Pool.runPendingTask())
+      ;
+#endif
+  }
+
+  ThreadPool &getPool() const { return Pool; }
+};
+
+} // end namespace llvm
+
+#endif
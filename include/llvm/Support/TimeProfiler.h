@@ -0,0 +1,87 @@
+//===- llvm/Support/TimeProfiler.h - Hierarchical time trace ----*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file declares a profiler that records nested, named time intervals and
+// writes them in the Chrome trace event format, for viewing in
+// chrome://tracing. Unlike TimerGroup, which sums the time of every region
+// with the same name, it keeps each interval, so one slow header or function
+// stands out from the aggregate.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_SUPPORT_TIMEPROFILER_H
+#define LLVM_SUPPORT_TIMEPROFILER_H
+
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/Compiler.h"
+
+namespace llvm {
+
+class raw_ostream;
+struct TimeTraceProfiler;
+
+/// The active profiler, or null if tracing is off. Recording costs a single
+/// test of this pointer when tracing is off. Intervals are only recorded
+/// from the thread that called timeTraceProfilerInitialize.
+extern TimeTraceProfiler *TimeTraceProfilerInstance;
+
+/// Start recording intervals opened on the calling thread. Intervals shorter
+/// than \p GranularityUs microseconds are dropped when the trace is written,
+/// which keeps traces of large translation units readable.
+void timeTraceProfilerInitialize(unsigned GranularityUs = 500);
+
+/// Stop recording and discard what was recorded.
+void timeTraceProfilerCleanup();
+
+/// Is time tracing on?
+inline bool timeTraceProfilerEnabled() {
+  return TimeTraceProfilerInstance != nullptr;
+}
+
+/// Write the recorded intervals to \p OS as a Chrome trace JSON object. Each
+/// interval becomes a complete ("X") event, and intervals of the same name
+/// are also summed into "Total <name>" events, so the totals that
+/// -ftime-report shows are in the same file.
+void timeTraceProfilerWrite(raw_ostream &OS);
+
+/// Open an interval named \p Name, e.g. "ParseClass" or "RunPass", with
+/// \p Detail giving the entity it is for, e.g. a class, function or file
+/// name. Intervals must be closed in the reverse order they were opened.
+void timeTraceProfilerBegin(StringRef Name, StringRef Detail);
+
+/// Close the innermost open interval.
+void timeTraceProfilerEnd();
+
+/// The time trace equivalent of a TimeRegion: records the lifetime of the
+/// object as one interval.
+///
+/// \code
+///   TimeTraceScope Scope("InstantiateFunction", FD->getName());
+/// \endcode
+///
+/// Building \p Detail can be costly (printing a qualified name, say), so
+/// callers should only do so when timeTraceProfilerEnabled().
+struct TimeTraceScope {
+  TimeTraceScope(StringRef Name, StringRef Detail) {
+    if (TimeTraceProfilerInstance)
+      timeTraceProfilerBegin(Name, Detail);
+  }
+  ~TimeTraceScope() {
+    if (TimeTraceProfilerInstance)
+      timeTraceProfilerEnd();
+  }
+
+private:
+  TimeTraceScope(const TimeTraceScope &) LLVM_DELETED_FUNCTION;
+  void operator=(const TimeTraceScope &) LLVM_DELETED_FUNCTION;
+};
+
+} // end namespace llvm
+
+#endif
@@ -13,6 +13,7 @@
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/Compiler.h"
 #include "llvm/Support/DataTypes.h"
+#include <algorithm>
 #include <cassert>
 #include <string>
 #include <utility>
@@ -28,9 +29,13 @@ class TimeRecord {
   double WallTime;       // Wall clock time elapsed in seconds
   double UserTime;       // User time elapsed
   double SystemTime;     // System time elapsed
+  double ThreadTime;     // CPU time of the calling thread elapsed
   ssize_t MemUsed;       // Memory allocated (in bytes)
+  size_t PeakRSS;        // Peak resident set size when the record was taken
 public:
-  TimeRecord() : WallTime(0), UserTime(0), SystemTime(0), MemUsed(0) {}
+  TimeRecord()
+    : WallTime(0), UserTime(0), SystemTime(0), ThreadTime(0), MemUsed(0),
+      PeakRSS(0) {}
   
   /// getCurrentTime - Get the current time and memory usage.  If Start is true
   /// we get the memory usage before the time, otherwise we get time before
@@ -42,7 +47,16 @@ public:
   double getUserTime() const { return UserTime; }
   double getSystemTime() const { return SystemTime; }
   double getWallTime() const { return WallTime; }
+  /// getThreadTime - CPU time spent by the thread that took the record. Unlike
+  /// the process times, it does not include work done meanwhile by other
+  /// threads, so it is the one to compare between timers run in parallel.
+  double getThreadTime() const { return ThreadTime; }
   ssize_t getMemUsed() const { return MemUsed; }
+  /// getPeakRSS - The peak RSS of the process at the end of the interval.
+  /// Peaks do not add up, so combining records keeps the largest one; the
+  /// -ftime-report line of a phase thus shows the peak reached by the time
+  /// it ended.
+  size_t getPeakRSS() const { return PeakRSS; }
   
   
   // operator< - Allow sorting.
@@ -55,12 +69,15 @@ public:
     WallTime   += RHS.WallTime;
     UserTime   += RHS.UserTime;
     SystemTime += RHS.SystemTime;
+    ThreadTime += RHS.ThreadTime;
     MemUsed    += RHS.MemUsed;
+    PeakRSS     = std::max(PeakRSS, RHS.PeakRSS);
   }
   void operator-=(const TimeRecord &RHS) {
     WallTime   -= RHS.WallTime;
     UserTime   -= RHS.UserTime;
     SystemTime -= RHS.SystemTime;
+    ThreadTime -= RHS.ThreadTime;
     MemUsed    -= RHS.MemUsed;
   }
   
@@ -77,6 +94,12 @@ public:
 /// when its TimerGroup is destroyed.  Timers do not print their information
 /// if they are never started.
 ///
+/// A timer may be started and stopped on several threads at once, as pass
+/// timers are when functions are compiled in parallel. Each thread keeps its
+/// own start record, and stopTimer adds the elapsed time to the timer under
+/// a lock, so the wall time reported is the sum over threads while the
+/// thread time column shows the CPU time actually spent.
+///
 class Timer {
   TimeRecord Time;
   std::string Name;      // The name of this time variable.
@@ -157,6 +180,8 @@ struct NamedRegionTimer : public TimeRegion {
 /// report that is printed when the TimerGroup is destroyed.  It is illegal to
 /// destroy a TimerGroup object before all of the Timers in it are gone.  A
 /// TimerGroup can be specified for a newly created timer in its constructor.
+/// Adding, removing and printing timers is serialized by a global lock, so
+/// groups may be printed while other threads are still running timers.
 ///
 class TimerGroup {
   std::string Name;
@@ -971,6 +971,14 @@ public:
   bool setCurrentDocument();
   void nextDocument();
 
+  // These are only used by streamSequence. beginStreamingSequence() checks
+  // that the current document is a sequence without building its HNodes.
+  // Each nextStreamingElement() then parses one element, makes it the
+  // current node, and releases the nodes of the previous element, so memory
+  // use is bounded by the largest element rather than by the document.
+  bool beginStreamingSequence();
+  bool nextStreamingElement();
+
 private:
   llvm::SourceMgr                     SrcMgr; // must be before Strm
   std::unique_ptr<llvm::yaml::Stream> Strm;
@@ -1127,6 +1135,25 @@ operator>>(Input &yin, T &docList) {
   return yin;
 }
 
+// Map the elements of a document that is a sequence one at a time, passing
+// each to Callback once it is complete, instead of building the whole
+// document first. Scalars that need no unescaping refer directly into the
+// input buffer, so the input must outlive the elements. Returns false if
+// the document is not a sequence or an element failed to map.
+template <typename T, typename CallbackT>
+inline bool streamSequence(Input &yin, CallbackT Callback) {
+  if (!yin.setCurrentDocument() || !yin.beginStreamingSequence())
+    return false;
+  while (yin.nextStreamingElement()) {
+    T Element;
+    yamlize(yin, Element, true);
+    if (yin.error())
+      return false;
+    Callback(Element);
+  }
+  return !yin.error();
+}
+
 // Define non-member operator>> so that Input can stream in a map as a document.
 template <typename T>
 inline
@@ -321,6 +321,10 @@ class raw_fd_ostream : public raw_ostream {
 
   uint64_t pos;
 
+  /// Async - The background writer, if SetAsyncFlush(true) was called.
+  class AsyncWriter;
+  AsyncWriter *Async;
+
   /// write_impl - See raw_ostream::write_impl.
   void write_impl(const char *Ptr, size_t Size) override;
 
@@ -328,6 +332,10 @@ class raw_fd_ostream : public raw_ostream {
   /// counting the bytes currently in the buffer.
   uint64_t current_pos() const override { return pos; }
 
+  /// waitForAsyncWrites - Block until the background writer, if any, has
+  /// written everything handed to it, and pick up any error it hit.
+  void waitForAsyncWrites();
+
   /// preferred_buffer_size - Determine an efficient buffer size.
   size_t preferred_buffer_size() const override;
 
@@ -373,6 +381,24 @@ public:
     UseAtomicWrites = Value;
   }
 
+  /// LargeBufferSize - The buffer size SetLargeBuffer installs.
+  static const size_t LargeBufferSize = 4 * 1024 * 1024;
+
+  /// SetLargeBuffer - Buffer LargeBufferSize bytes before writing, instead of
+  /// the size preferred_buffer_size picks. Big outputs such as .s and .ll
+  /// files are then written a few large write calls at a time, which
+  /// matters where each system call is expensive, as on Cygwin.
+  void SetLargeBuffer() { SetBufferSize(LargeBufferSize); }
+
+  /// SetAsyncFlush - If Value is true, hand each full buffer to a background
+  /// thread that writes it while the stream fills the other of two buffers,
+  /// swapped in with SetBuffer. flush only queues the buffer; seek, close
+  /// and the destructor wait for the writes in flight, so the file and
+  /// has_error are only up to date after one of them. This pays off only
+  /// with a large buffer, so it implies SetLargeBuffer. It must be set before
+  /// anything is written, and is ignored for unbuffered streams.
+  void SetAsyncFlush(bool Value);
+
   raw_ostream &changeColor(enum Colors colors, bool bold=false,
                            bool bg=false) override;
   raw_ostream &resetColor() override;
@@ -14,6 +14,8 @@
 #ifndef LLVM_TABLEGEN_MAIN_H
 #define LLVM_TABLEGEN_MAIN_H
 
+#include "llvm/ADT/ArrayRef.h"
+
 namespace llvm {
 
 class RecordKeeper;
@@ -24,6 +26,30 @@ typedef bool TableGenMainFn(raw_ostream &OS, RecordKeeper &Records);
 
 int TableGenMain(char *argv0, TableGenMainFn *MainFn);
 
+/// \brief One backend run of a multi-output tblgen invocation.
+struct TableGenJob {
+  /// The name reported by -time-backends, such as "-gen-dag-isel".
+  const char *Name;
+  /// The file the backend writes, or "-" for standard output.
+  const char *OutputFilename;
+  TableGenMainFn *MainFn;
+};
+
+/// \brief Parse the input .td file once and run every job in \p Jobs on
+/// the records, each writing its own output file.
+///
+/// The records are not modified once parsed, so the jobs run concurrently on
+/// up to \p NumThreads threads (0 means one per hardware thread). The
+/// hash-consed Init tables that backends may still add to are guarded by a
+/// lock while more than one job runs. An output file is only rewritten if
+/// its contents changed, so the build does not redo work that depends on
+/// an unchanged .inc file. With -time-backends,
+/// the wall time of the parse and of each job is printed to stderr.
+///
+/// \returns 1 if parsing or any job failed, 0 otherwise.
+int TableGenMain(char *argv0, ArrayRef<TableGenJob> Jobs,
+                 unsigned NumThreads = 0);
+
 }
 
 #endif
@@ -24,6 +24,7 @@ namespace llvm {
 class InstrItineraryData;
 class LiveVariables;
 class MCAsmInfo;
+class MachineLoop;
 class MachineMemOperand;
 class MachineRegisterInfo;
 class MDNode;
@@ -315,6 +316,26 @@ public:
     llvm_unreachable("Target didn't implement TargetInstrInfo::InsertBranch!");
   }
 
+  /// analyzeLoop - Analyze the single-block loop \p L for the machine
+  /// pipeliner. On success, return false and set IndVarInst to the
+  /// instruction that updates the induction variable and CmpInst to the
+  /// compare that feeds the loop branch. Return true if the loop cannot be
+  /// pipelined.
+  virtual bool analyzeLoop(MachineLoop &L, MachineInstr *&IndVarInst,
+                           MachineInstr *&CmpInst) const {
+    return true;
+  }
+
+  /// reduceLoopCount - Adjust the trip count of the loop ending in \p MBB,
+  /// whose induction variable is updated by \p IndVar, so that it runs
+  /// \p Iter fewer times, for the iterations moved into the prologue and
+  /// epilogue by the pipeliner. Returns the number of iterations left, when
+  /// known, or 0.
+  virtual unsigned reduceLoopCount(MachineBasicBlock &MBB,
+                                   MachineInstr *IndVar, unsigned Iter) const {
+    llvm_unreachable("Target didn't implement reduceLoopCount!");
+  }
+
   /// ReplaceTailWithBranchTo - Delete the instruction OldInst and everything
   /// after it, replacing it with an unconditional branch to NewDest. This is
   /// used by the tail merging pass.
@@ -1006,6 +1027,50 @@ public:
     return nullptr;
   }
 
+  //===--------------------------------------------------------------------===//
+  /// Machine outliner hooks.
+  ///
+  /// The MachineOutliner calls these to decide which instruction sequences may
+  /// be moved into a shared function and what replacing them costs.  A target
+  /// that does not override isFunctionSafeToOutlineFrom never has code
+  /// outlined.
+
+  /// Return true if instructions of \p MF may be outlined.  Functions with
+  /// their own unwind info or red zone use, for instance, are not.
+  virtual bool isFunctionSafeToOutlineFrom(MachineFunction &MF) const {
+    return false;
+  }
+
+  /// Return true if \p MI may be part of an outlined sequence.  Stack pointer
+  /// relative accesses, instructions that read or write the return address
+  /// register, and position dependent references usually may not.
+  virtual bool isLegalToOutline(const MachineInstr *MI) const {
+    return false;
+  }
+
+  /// Return the number of bytes a call to an outlined function occupies at
+  /// each site, including any code needed to preserve the return address.
+  virtual unsigned getOutlinedCallOverhead() const { return 0; }
+
+  /// Return the number of bytes the outlined function adds beyond the
+  /// sequence itself, i.e. its return and prologue if any.
+  virtual unsigned getOutlinedFrameOverhead() const { return 0; }
+
+  /// Insert a call to \p Callee before \p It, replacing a sequence that
+  /// the caller has already removed.  Return the call instruction.
+  virtual MachineBasicBlock::iterator
+  insertOutlinedCall(MachineBasicBlock &MBB, MachineBasicBlock::iterator It,
+                     MachineFunction &Callee) const {
+    llvm_unreachable("Target didn't implement insertOutlinedCall!");
+  }
+
+  /// Finish the body of the outlined function \p MF, which holds a copy of
+  /// the sequence, by adding its frame setup and return.
+  virtual void buildOutlinedFrame(MachineBasicBlock &MBB,
+                                  MachineFunction &MF) const {
+    llvm_unreachable("Target didn't implement buildOutlinedFrame!");
+  }
+
 private:
   int CallFrameSetupOpcode, CallFrameDestroyOpcode;
 };
@@ -45,11 +45,14 @@ namespace llvm {
   class FunctionLoweringInfo;
   class ImmutableCallSite;
   class IntrinsicInst;
+  class LoadInst;
   class MachineBasicBlock;
   class MachineFunction;
   class MachineInstr;
   class MachineJumpTableInfo;
   class Mangler;
+  class ShuffleVectorInst;
+  class StoreInst;
   class MCContext;
   class MCExpr;
   class MCSymbol;
@@ -423,6 +426,30 @@ public:
     return false;
   }
 
+  /// Return the largest interleave factor lowerInterleavedLoad and
+  /// lowerInterleavedStore accept, or 0 if the target has no structure memory
+  /// operations.
+  virtual unsigned getMaxSupportedInterleaveFactor() const { return 0; }
+
+  /// Lower an interleaved load to target structure loads (e.g. NEON vld2-4).
+  /// \p LI is a wide load whose members are extracted by the strided
+  /// shufflevectors \p Shuffles, member \p Indices[i] being the result of
+  /// \p Shuffles[i]. Return true if the load and shuffles were replaced.
+  virtual bool lowerInterleavedLoad(LoadInst *LI,
+                                    ArrayRef<ShuffleVectorInst *> Shuffles,
+                                    ArrayRef<unsigned> Indices,
+                                    unsigned Factor) const {
+    return false;
+  }
+
+  /// Lower an interleaved store to target structure stores (e.g. NEON
+  /// vst2-4). \p SI stores the interleaving shufflevector \p SVI of
+  /// \p Factor members. Return true if the store and shuffle were replaced.
+  virtual bool lowerInterleavedStore(StoreInst *SI, ShuffleVectorInst *SVI,
+                                     unsigned Factor) const {
+    return false;
+  }
+
   /// Returns true if the target can instruction select the specified FP
   /// immediate natively. If false, the legalizer will materialize the FP
   /// immediate as a load from a constant pool.
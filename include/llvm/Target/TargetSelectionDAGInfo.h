@@ -53,6 +53,11 @@ public:
   /// expanded in a place where calls are not feasible (e.g. within the prologue
   /// for another call). If the target chooses to decline an AlwaysInline
   /// request here, legalize will resort to using simple loads and stores.
+  ///
+  /// Op3, the size, need not be a constant. When it is not, its known bits
+  /// (DAG.computeKnownBits) may still bound it, which lets a target expand
+  /// a bounded variable-size copy into a loop of vector loads and stores
+  /// rather than fall back to the library call.
   virtual SDValue
   EmitTargetCodeForMemcpy(SelectionDAG &DAG, SDLoc dl,
                           SDValue Chain,
@@ -150,12 +155,21 @@ public:
     return std::make_pair(SDValue(), SDValue());
   }
 
+  /// EmitTargetCodeForStrlen - Emit target-specific code that performs a
+  /// strlen, in cases where that is faster than a libcall, for instance a
+  /// vector loop that compares 16 bytes at a time once Src is aligned.  The
+  /// first returned SDValue is the length and the second is the chain.  Both
+  /// SDValues can be null if a normal libcall should be used.
   virtual std::pair<SDValue, SDValue>
   EmitTargetCodeForStrlen(SelectionDAG &DAG, SDLoc DL, SDValue Chain,
                           SDValue Src, MachinePointerInfo SrcPtrInfo) const {
     return std::make_pair(SDValue(), SDValue());
   }
 
+  /// EmitTargetCodeForStrnlen - Like EmitTargetCodeForStrlen, but the
+  /// result is at most MaxLength.  Bytes at or past Src + MaxLength may only
+  /// be read as part of an aligned vector that also holds bytes before it,
+  /// as such a load cannot cross into an unmapped page.
   virtual std::pair<SDValue, SDValue>
   EmitTargetCodeForStrnlen(SelectionDAG &DAG, SDLoc DL, SDValue Chain,
                            SDValue Src, SDValue MaxLength,
@@ -66,6 +66,11 @@ public:
   /// scheduler. It does not yet disable the postRA scheduler.
   virtual bool enableMachineScheduler() const;
 
+  /// \brief True if the subtarget should run MachinePipeliner on innermost
+  /// single-block loops. Requires TargetInstrInfo::analyzeLoop and
+  /// reduceLoopCount, and a scheduling model with instruction latencies.
+  virtual bool enableMachinePipeliner() const { return false; }
+
   /// \brief Override generic scheduling policy within a region.
   ///
   /// This is a convenient way for targets that don't provide any custom
@@ -24,6 +24,7 @@ class Pass;
 class Function;
 class BasicBlock;
 class GlobalValue;
+class raw_ostream;
 
 //===----------------------------------------------------------------------===//
 //
@@ -192,6 +193,72 @@ ModulePass *createMergeFunctionsPass();
 ///
 ModulePass *createPartialInliningPass();
 
+//===----------------------------------------------------------------------===//
+/// createHotColdSplittingPass - This pass extracts the cold regions of each
+/// function (blocks that BlockFrequencyInfo, with profile branch weights when
+/// available, says almost never run, such as error paths, exception handlers
+/// and assertion failures) into new internal functions marked cold and
+/// noinline, leaving a call in their place. With
+/// TargetOptions::ColdFunctionSection the split-off code is then emitted
+/// away from the hot text.
+///
+ModulePass *createHotColdSplittingPass();
+
+//===----------------------------------------------------------------------===//
+/// createObjCMsgSendDevirtPass - This pass rebuilds the Objective-C class
+/// hierarchy and the method lists of every class and category from the
+/// __objc_classlist, __objc_catlist and class_ro_t metadata in the module,
+/// and turns objc_msgSend calls whose receiver class is known and whose
+/// selector has a single implementation in it into direct calls of that
+/// implementation, which the inliner can then see. The receiver class is
+/// known for the result of +alloc on a class reference, and for classes with
+/// no subclasses or categories in the image. It only runs on whole programs:
+/// classes that are visible to other images, or that are the subject of
+/// runtime method swizzling, must be listed in \p ExportedClasses.
+///
+ModulePass *createObjCMsgSendDevirtPass(
+    ArrayRef<const char *> ExportedClasses = ArrayRef<const char *>());
+
+//===----------------------------------------------------------------------===//
+/// createObjCIvarOffsetFoldingPass - With the non-fragile ABI, every ivar
+/// access loads its offset from an OBJC_IVAR_$_Class.ivar global. When the
+/// class and all of its superclasses are defined in the module, the layout
+/// the runtime will compute is already known. This pass replaces loads of
+/// such a global with the constant offset it will hold, removing a
+/// dependent load from every ivar access. The globals themselves stay, for
+/// the runtime and for code outside the module. Classes that may be
+/// extended by another image while it runs must be listed in
+/// \p ExportedClasses.
+///
+ModulePass *createObjCIvarOffsetFoldingPass(
+    ArrayRef<const char *> ExportedClasses = ArrayRef<const char *>());
+
+//===----------------------------------------------------------------------===//
+/// createObjCMetadataStripPass - After modules are linked, each selector and
+/// class may still have one __objc_selrefs or __objc_classrefs entry per
+/// original module. This pass merges them into one reference each, and it
+/// removes the method list entries and categories of classes that are not
+/// in \p ExportedClasses when nothing in the module can send their
+/// selectors. Every reference or method removed means one less fixup for dyld
+/// and the runtime at launch. The bytes of metadata removed are reported
+/// through -stats.
+///
+ModulePass *createObjCMetadataStripPass(
+    ArrayRef<const char *> ExportedClasses = ArrayRef<const char *>());
+
+//===----------------------------------------------------------------------===//
+/// createStartupReportPass - This pass reads the llvm.startup named metadata,
+/// which clang's -fstartup-report attaches to each static initializer and
+/// +load method as a (function, kind, source file) tuple, and prints one line
+/// per function with its estimated cost: its instruction count and the
+/// instruction counts of the functions it calls in the module. If
+/// \p OrderFile is non-null, it also writes an order file listing those
+/// functions and their callees in the order they run, so that ld64 can put
+/// the startup code on as few pages as possible.
+///
+ModulePass *createStartupReportPass(raw_ostream &OS,
+                                    raw_ostream *OrderFile = nullptr);
+
 //===----------------------------------------------------------------------===//
 // createMetaRenamerPass - Rename everything with metasyntatic names.
 //
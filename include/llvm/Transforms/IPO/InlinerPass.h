@@ -17,12 +17,14 @@
 #ifndef LLVM_TRANSFORMS_IPO_INLINERPASS_H
 #define LLVM_TRANSFORMS_IPO_INLINERPASS_H
 
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/Analysis/CallGraphSCCPass.h"
+#include "llvm/Analysis/InlineCost.h"
 
 namespace llvm {
   class CallSite;
   class DataLayout;
-  class InlineCost;
+  class Instruction;
   template<class PtrType, unsigned SmallSize>
   class SmallPtrSet;
 
@@ -57,6 +59,10 @@ struct Inliner : public CallGraphSCCPass {
   /// given on the comand line. It is higher if the callee is marked with the
   /// inlinehint attribute.
   ///
+  /// When the caller carries profile data, a hot call site gets
+  /// InlineConstants::HotCallSiteThreshold and a cold one a threshold of 0,
+  /// so that only always_inline callees are inlined there.
+  ///
   unsigned getInlineThreshold(CallSite CS) const;
 
   /// getInlineCost - This method must be implemented by the subclass to
@@ -81,9 +87,66 @@ private:
   // InsertLifetime - Insert @llvm.lifetime intrinsics.
   bool InsertLifetime;
 
+  /// CachedInlineCost - The cost of one call site, and the versions of the
+  /// callee and caller bodies it was computed for.
+  struct CachedInlineCost {
+    const Function *Callee;
+    unsigned CalleeEpoch;
+    unsigned CallerEpoch;
+    InlineCost Cost;
+    CachedInlineCost(const Function *Callee, unsigned CalleeEpoch,
+                     unsigned CallerEpoch, InlineCost Cost)
+      : Callee(Callee), CalleeEpoch(CalleeEpoch), CallerEpoch(CallerEpoch),
+        Cost(Cost) {}
+  };
+
+  /// InlineCostCache - Costs already computed for call sites during the
+  /// current runOnSCC, so that call sites revisited while the SCC is iterated
+  /// again, or evaluated again for the "inlining into the callers instead"
+  /// check, are not re-analyzed.
+  ///
+  /// The cache is cleared when runOnSCC starts and when it returns. The
+  /// function passes that run between two visits (instcombine, simplifycfg,
+  /// ...) can erase calls, whose addresses may then be reused by new calls,
+  /// and can change the arguments a cost depends on, so no entry may outlive
+  /// the visit it was computed in. This also bounds the cache by the size of
+  /// one SCC and its callers.
+  DenseMap<const Instruction *, CachedInlineCost> InlineCostCache;
+
+  /// FunctionEpochs - Bumped each time code is inlined into a function.
+  /// A cached cost is only used while the epochs of both its callee and its
+  /// caller are unchanged; within a runOnSCC, inlining is the only way either
+  /// body changes. Cleared together with InlineCostCache.
+  DenseMap<const Function *, unsigned> FunctionEpochs;
+
+  /// clearInlineCostCache - Forget every cached cost and epoch.
+  void clearInlineCostCache() {
+    InlineCostCache.clear();
+    FunctionEpochs.clear();
+  }
+
+  /// getCachedInlineCost - Return the cost of \p CS from the cache, computing
+  /// it with getInlineCost and caching it if it is missing or stale.
+  InlineCost getCachedInlineCost(CallSite CS);
+
+  /// invalidateInlineCosts - Forget the cached cost of the call site \p Call,
+  /// which is about to be erased, and note that \p Caller changed.
+  void invalidateInlineCosts(const Instruction *Call, const Function *Caller);
+
   /// shouldInline - Return true if the inliner should attempt to
   /// inline at the given CallSite.
   bool shouldInline(CallSite CS);
+
+  /// isHotCallSite - Return true if \p CS is in a caller that
+  /// -fprofile-instr-use marked as hot, and the branch weights on the way
+  /// from the entry block make its block run at least as often as the
+  /// entry.
+  bool isHotCallSite(CallSite CS) const;
+
+  /// isColdCallSite - Return true if the profile data shows that \p CS
+  /// never ran: its caller is marked cold, or a branch weight of zero
+  /// guards its block.
+  bool isColdCallSite(CallSite CS) const;
 };
 
 } // End llvm namespace
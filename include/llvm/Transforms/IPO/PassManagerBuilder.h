@@ -112,6 +112,7 @@ public:
   bool SLPVectorize;
   bool LoopVectorize;
   bool RerollLoops;
+  bool SplitColdCode;
 
 private:
   /// ExtensionList - This is list of all of the extensions that are registered.
@@ -138,8 +139,21 @@ public:
 
   /// populateModulePassManager - This sets up the primary pass manager.
   void populateModulePassManager(PassManagerBase &MPM);
+
+  /// populateLTOPassManager - This sets up the link time pass pipeline. When
+  /// \p RunInliner is true, ObjCARCIPO runs right after the inliner to remove
+  /// the ARC return value pairs that inlining exposed.
   void populateLTOPassManager(PassManagerBase &PM, bool Internalize,
                               bool RunInliner, bool DisableGVNLoadPRE = false);
+
+  /// populateLTOPassManager - As above, but only add the inter-procedural
+  /// part of the pipeline to \p IPOPM and the function-local cleanup that
+  /// follows it (GVN, InstCombine, the loop passes, ...) to \p FuncPM. Every
+  /// pass in \p FuncPM only looks at the function it runs on, so it may be run
+  /// separately on each partition of the module that \p IPOPM produced.
+  void populateLTOPassManager(PassManagerBase &IPOPM, PassManagerBase &FuncPM,
+                              bool Internalize, bool RunInliner,
+                              bool DisableGVNLoadPRE = false);
 };
 
 /// Registers a function for adding a standard set of passes.  This should be
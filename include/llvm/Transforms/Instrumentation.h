@@ -59,11 +59,35 @@ struct GCOVOptions {
   // Emit the name of the function in the .gcda files. This is redundant, as
   // the function identifier can be used to find the name from the .gcno file.
   bool FunctionNamesInData;
+
+  // Run ProfileCounterPromotion on each instrumented function, so that edge
+  // counters inside loops are kept in registers and only written back on
+  // loop exits.
+  bool PromoteCounters;
 };
 ModulePass *createGCOVProfilerPass(const GCOVOptions &Options =
                                    GCOVOptions::getDefault());
 
-// Insert AddressSanitizer (address sanity checking) instrumentation
+// ProfileCounterPromotion - Within each loop that has dedicated exit blocks,
+// turn the load/add/store sequences that increment GCOV (__llvm_gcov_ctr*)
+// and instrprof (__llvm_profile_counters*) counters into an increment of a
+// register, and add the register to the counter in every exit block. Hot
+// loops in multi-threaded code then write each shared counter cache line
+// once per loop instead of once per iteration. Counts are only lost if the
+// program exits from inside the loop.
+FunctionPass *createProfileCounterPromotionPass();
+
+// Insert function order tracing: on its first call, each function appends
+// its address to a per-thread buffer through __llvm_order_trace. A one byte
+// flag per function makes every later call cost a load and a branch. The
+// runtime writes the buffers out at exit, and llvm-orderfile turns the
+// symbolized traces into an ld64 -order_file.
+ModulePass *createFunctionOrderTracingPass();
+
+// Insert AddressSanitizer (address sanity checking) instrumentation.
+// On 32-bit ARM iOS the shadow offset is 1 << 30, an ARM modified immediate,
+// so the shadow address is a shift and an add with no constant pool load,
+// and the shadow byte is then loaded and compared.
 FunctionPass *createAddressSanitizerFunctionPass(
     bool CheckInitOrder = true, bool CheckUseAfterReturn = false,
     bool CheckLifetime = false, StringRef BlacklistFile = StringRef());
@@ -41,7 +41,41 @@ Pass *createObjCARCContractPass();
 //
 // ObjCARCOpt - ObjC ARC optimization.
 //
-Pass *createObjCARCOptPass();
+// The retain/release dataflow tracks one state per pointer, kept in blocks
+// of a per-function array indexed by dense pointer IDs, and visits blocks in
+// SCC order. If a function has more than MaxPtrStates tracked pointers, the
+// pass stops pairing in it and only does the local simplifications, which
+// bounds its cost on very large methods. 0 means no limit.
+//
+Pass *createObjCARCOptPass(unsigned MaxPtrStates = 4096);
+
+//===----------------------------------------------------------------------===//
+//
+// ObjCARCIPO - ObjC ARC cleanups across former call boundaries.
+//
+// After inlining, an objc_autoreleaseReturnValue from an inlined callee and
+// the objc_retainAutoreleasedReturnValue of its caller may end up in the same
+// function with only the returned value between them. Where provenance
+// analysis shows the two calls act on the same object and nothing in between
+// may release it, both calls are removed. Callees that always return such a
+// +0 value are recorded first, so the pairs removed include those split by a
+// call that was not inlined. Does nothing in modules that do not use ARC.
+//
+Pass *createObjCARCIPOPass();
+
+//===----------------------------------------------------------------------===//
+//
+// ObjCARCBlockStackPromotion - Keep non-escaping blocks on the stack.
+//
+// Removes the objc_retainBlock or _Block_copy of a stack block literal, and
+// its matching release, when the copy provably does not outlive the frame:
+// every use of it is a call argument marked nocapture, or an argument of a
+// call known not to keep it, such as dispatch_sync or
+// -enumerateObjectsUsingBlock:, and the release is reached on every path
+// out of the function. Front ends tell the pass about other APIs that take
+// non-escaping blocks by marking those parameters nocapture.
+//
+Pass *createObjCARCBlockStackPromotionPass();
 
 } // End llvm namespace
 
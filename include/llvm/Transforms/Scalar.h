@@ -107,7 +107,18 @@ Pass *createIndVarSimplifyPass();
 // into:
 //    %Z = add int 2, %X
 //
+// The pass repeats its worklist walk over the function until nothing changes.
+// MaxIterations bounds the number of walks per function (0, the default, uses
+// -instcombine-max-iterations, which is unlimited unless given); the pass
+// stops early once the bound is hit, which keeps huge functions from taking
+// quadratic time at the cost of possibly leaving combines undone.
+//
+// With -stats, the pass reports the number of walks, of instructions added
+// back to the worklist, and of successful combines per visit method
+// ("instcombine.visitAdd", ...), so the costly visitors can be identified.
+//
 FunctionPass *createInstructionCombiningPass();
+FunctionPass *createInstructionCombiningPass(unsigned MaxIterations);
 
 //===----------------------------------------------------------------------===//
 //
@@ -122,7 +133,16 @@ Pass *createLICMPass();
 //
 Pass *createLoopStrengthReducePass();
 
-Pass *createGlobalMergePass(const TargetMachine *TM = nullptr);
+//===----------------------------------------------------------------------===//
+//
+// GlobalMerge - This pass merges internal globals that are used together into
+// one struct, so that they are addressed from a single base register. With
+// MergeConstants, internal constant globals are merged as well, into a
+// separate struct; under LTO, once the module has been internalized, this
+// covers most of the program's constant data.
+//
+Pass *createGlobalMergePass(const TargetMachine *TM = nullptr,
+                            bool MergeConstants = false);
 
 //===----------------------------------------------------------------------===//
 //
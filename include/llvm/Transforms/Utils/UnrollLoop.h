@@ -27,6 +27,13 @@ bool UnrollLoop(Loop *L, unsigned Count, unsigned TripCount, bool AllowRuntime,
                 unsigned TripMultiple, LoopInfo *LI, Pass *PP,
                 LPPassManager *LPM);
 
+/// UnrollAndJamLoop - Unroll the outer loop \p L by \p Count and fuse the
+/// resulting copies of its single inner loop into one inner loop. Returns
+/// false, leaving the nest unchanged, if \p L is not a legal candidate.
+bool UnrollAndJamLoop(Loop *L, unsigned Count, unsigned TripCount,
+                      unsigned TripMultiple, LoopInfo *LI, Pass *PP,
+                      LPPassManager *LPM);
+
 bool UnrollRuntimeLoopProlog(Loop *L, unsigned Count, LoopInfo *LI,
                              LPPassManager* LPM);
 
@@ -114,6 +114,10 @@ createBBVectorizePass(const VectorizeConfig &C = VectorizeConfig());
 //
 // LoopVectorize - Create a loop vectorization pass.
 //
+// Strided accesses whose members together cover consecutive memory, such as
+// the channels of interleaved pixel data, are vectorized as one group when
+// TargetTransformInfo::getInterleavedMemoryOpCost finds it profitable.
+//
 Pass *createLoopVectorizePass(bool NoUnrolling = false,
                               bool AlwaysVectorize = true);
 
@@ -121,6 +125,12 @@ Pass *createLoopVectorizePass(bool NoUnrolling = false,
 //
 // SLPVectorizer - Create a bottom-up SLP vectorizer pass.
 //
+// Besides trees rooted at stores, the pass matches horizontal reductions:
+// chains of adds, fadds (with fast-math), and of min/max compare-select
+// pairs, whose leaves are then vectorized. It emits a reduction when
+// TargetTransformInfo::getReductionCost or getMinMaxReductionCost makes it
+// cheaper than the scalar chain.
+//
 Pass *createSLPVectorizerPass();
 
 //===----------------------------------------------------------------------===//